@@ -0,0 +1 @@
+"C:\Program Files\Epic Games\UE_5.5\Engine\Binaries\Win64\UnrealEditor-Cmd.exe" "PATH_TO_YOUR_UPROJECT_FILE" -run=GridlyBenchmark -Records=10000 -Languages=8 -Namespaces=20 -Report="PATH_TO_YOUR_PROJECT\Saved\GridlyBenchmark.json"
\ No newline at end of file
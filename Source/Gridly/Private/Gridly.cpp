@@ -8,9 +8,14 @@
 #include "ISettingsContainer.h"
 #include "ISettingsModule.h"
 #include "ISettingsSection.h"
+#endif
+
 // For accessing Gridly's game settings
 #include "GridlyGameSettings.h"
-#endif
+
+// For over-the-air text updates in packaged builds
+#include "GridlyLocalizationCache.h"
+#include "Misc/CoreDelegates.h"
 
 // For logging functionality
 #include "Logging/LogMacros.h"
@@ -45,10 +50,19 @@ void FGridlyModule::StartupModule()
         }
     }
 #endif
+
+    // Cached texts are registered right away, the network refresh waits until HTTP is up
+    if (!GIsEditor && !IsRunningCommandlet() && GetDefault<UGridlyGameSettings>()->bEnableOverTheAirUpdates)
+    {
+        FGridlyLocalizationCache::RegisterCachedTexts();
+        PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&FGridlyLocalizationCache::StartBackgroundRefresh);
+    }
 }
 
 void FGridlyModule::ShutdownModule()
 {
+    FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+
 #if WITH_EDITOR
     if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
     {
@@ -2,6 +2,7 @@
 
 #include "Modules/ModuleInterface.h"
 #include "Logging/LogMacros.h" // For DECLARE_LOG_CATEGORY_EXTERN
+#include "Delegates/IDelegateInstance.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGridly, Log, Log);
 
@@ -10,4 +11,7 @@ class FGridlyModule : public IModuleInterface
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    FDelegateHandle PostEngineInitHandle;
 };
@@ -23,8 +23,101 @@ void UGridlyBPFunctionLibrary::EnableLocalizationPreview(const FString& Culture)
 #endif
 }
 
+void UGridlyBPFunctionLibrary::DisableLocalizationPreview()
+{
+#if WITH_EDITOR
+	FTextLocalizationManager::Get().DisableGameLocalizationPreview();
+#endif
+	RegisteredPreviewTexts.Reset();
+	LastPreviewChangeCount = 0;
+}
+
+TMap<TPair<FString, FString>, UGridlyBPFunctionLibrary::FPreviewText> UGridlyBPFunctionLibrary::RegisteredPreviewTexts;
+int32 UGridlyBPFunctionLibrary::LastPreviewChangeCount = 0;
+
 void UGridlyBPFunctionLibrary::UpdateLocalizationPreview(const TArray<FPolyglotTextData>& PolyglotTextDatas)
 {
-	FTextLocalizationManager::Get().RegisterPolyglotTextData(PolyglotTextDatas);
+#if WITH_EDITOR
+	// Texts registered before the preview was turned off elsewhere are registered again
+	if (!FTextLocalizationManager::Get().IsGameLocalizationPreviewEnabled())
+	{
+		RegisteredPreviewTexts.Reset();
+	}
+#endif
+
+	TMap<TPair<FString, FString>, FPreviewText> PreviousTexts = MoveTemp(RegisteredPreviewTexts);
+	RegisteredPreviewTexts.Reset();
+	RegisteredPreviewTexts.Reserve(PolyglotTextDatas.Num());
+
+	// Polyglot data replaces every culture of a text, so a text with any changed culture is registered whole
+	TArray<FPolyglotTextData> ChangedPolyglotTextDatas;
+	int32 NumChanges = 0;
+	for (const FPolyglotTextData& PolyglotTextData : PolyglotTextDatas)
+	{
+		const TPair<FString, FString> TextId(PolyglotTextData.GetNamespace(), PolyglotTextData.GetKey());
+
+		FPreviewText& Text = RegisteredPreviewTexts.Add(TextId);
+		Text.NativeCulture = PolyglotTextData.GetNativeCulture();
+		Text.NativeString = PolyglotTextData.GetNativeString();
+		Text.Strings.Add(Text.NativeCulture, Text.NativeString);
+		for (const FString& Culture : PolyglotTextData.GetLocalizedCultures())
+		{
+			FString LocalizedString;
+			PolyglotTextData.GetLocalizedString(Culture, LocalizedString);
+			Text.Strings.Add(Culture, MoveTemp(LocalizedString));
+		}
+
+		int32 NumTextChanges = 0;
+		const FPreviewText* PreviousText = PreviousTexts.Find(TextId);
+		for (const TPair<FString, FString>& String : Text.Strings)
+		{
+			const FString* PreviousString = PreviousText ? PreviousText->Strings.Find(String.Key) : nullptr;
+			if (!PreviousString || !PreviousString->Equals(String.Value, ESearchCase::CaseSensitive))
+			{
+				NumTextChanges++;
+			}
+		}
+
+		// Cultures that were removed or cleared since the previous update
+		if (PreviousText)
+		{
+			for (const TPair<FString, FString>& PreviousString : PreviousText->Strings)
+			{
+				if (!Text.Strings.Contains(PreviousString.Key))
+				{
+					NumTextChanges++;
+				}
+			}
+
+			PreviousTexts.Remove(TextId);
+		}
+
+		if (NumTextChanges > 0)
+		{
+			ChangedPolyglotTextDatas.Add(PolyglotTextData);
+			NumChanges += NumTextChanges;
+		}
+	}
+
+	// Texts no longer in the update keep only their native string
+	for (const TPair<TPair<FString, FString>, FPreviewText>& PreviousText : PreviousTexts)
+	{
+		ChangedPolyglotTextDatas.Emplace(ELocalizedTextSourceCategory::Game, PreviousText.Key.Key, PreviousText.Key.Value,
+			PreviousText.Value.NativeString, PreviousText.Value.NativeCulture);
+		NumChanges += PreviousText.Value.Strings.Num() - 1;
+	}
+
+	LastPreviewChangeCount = NumChanges;
+	if (ChangedPolyglotTextDatas.Num() > 0)
+	{
+		FTextLocalizationManager::Get().RegisterPolyglotTextData(ChangedPolyglotTextDatas);
+	}
+
+	// Also applies a preview culture that changed since the previous update
 	EnableLocalizationPreview(GetLocalizationPreviewCulture());
 }
+
+int32 UGridlyBPFunctionLibrary::GetLocalizationPreviewChangeCount()
+{
+	return LastPreviewChangeCount;
+}
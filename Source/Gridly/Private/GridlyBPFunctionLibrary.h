@@ -19,6 +19,31 @@ public:
 	UFUNCTION(Category = Gridly, BlueprintCallable)
 	static void EnableLocalizationPreview(const FString& Culture);
 
+	/** Turns the preview off and forgets the texts registered for it, so the next update registers every text */
+	UFUNCTION(Category = Gridly, BlueprintCallable)
+	static void DisableLocalizationPreview();
+
+	/**
+	 * Registers only the texts that changed since the previous update. Cultures that a text no longer has, and texts that
+	 * are no longer in the update, are registered again without those translations
+	 */
 	UFUNCTION(Category = Gridly, BlueprintCallable)
 	static void UpdateLocalizationPreview(const TArray<FPolyglotTextData>& PolyglotTextDatas);
+
+	/** Number of (namespace, key, culture) strings that changed or were removed in the last UpdateLocalizationPreview call */
+	UFUNCTION(Category = Gridly, BlueprintPure)
+	static int32 GetLocalizationPreviewChangeCount();
+
+private:
+	struct FPreviewText
+	{
+		FString NativeCulture;
+		FString NativeString;
+		/** Last registered string per culture, including the native culture */
+		TMap<FString, FString> Strings;
+	};
+
+	/** Last registered text per (namespace, key) */
+	static TMap<TPair<FString, FString>, FPreviewText> RegisteredPreviewTexts;
+	static int32 LastPreviewChangeCount;
 };
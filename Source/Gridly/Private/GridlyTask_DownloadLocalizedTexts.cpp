@@ -5,9 +5,15 @@
 #include "Engine/EngineTypes.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
 #include "Gridly.h"
+#include "GridlyApi.h"
+#include "GridlyCultureConverter.h"
+#include "GridlyDownloadCheckpoint.h"
 #include "GridlyGameSettings.h"
 #include "GridlyLocalizedTextConverter.h"
+#include "GridlyStats.h"
 #include "GridlyTableRow.h"
 #include "HttpModule.h"
 #include "JsonObjectConverter.h"
@@ -26,7 +32,8 @@ void UGridlyTask_DownloadLocalizedTexts::Activate()
 {
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 
-	Limit = GameSettings->ImportMaxRecordsPerRequest;
+	BatchSizer.Reset(GameSettings->ImportMaxRecordsPerRequest);
+	Limit = BatchSizer.GetBatchSize();
 	TotalCount = 0;
 
 	ViewIds.Reset();
@@ -38,13 +45,70 @@ void UGridlyTask_DownloadLocalizedTexts::Activate()
 		}
 	}
 
+	const TArray<FString> Cultures = FGridlyCultureConverter::GetTargetCultures();
+	TextRecords.Reset(Cultures);
+	ColumnIds = FGridlyApi::GetTextColumnIds(Cultures, Cultures);
 	PolyglotTextDatas.Reset();
 
-	RequestPage(0, 0);
+	const FString CheckpointName = CheckpointKey.IsEmpty() ? FString(TEXT("DownloadLocalizedTexts")) : TEXT("DownloadLocalizedTexts_") + CheckpointKey;
+	Checkpoint.Open(CheckpointName, FString::Join(ViewIds, TEXT(",")) + TEXT("|") + FString::Join(ColumnIds, TEXT(","))
+		+ TEXT("|") + FString::Join(Cultures, TEXT(",")));
+
+	int ViewIdIndex = 0;
+	int Offset = 0;
+	ResumeFromCheckpoint(ViewIdIndex, Offset);
+
+	RequestPage(ViewIdIndex, Offset);
+}
+
+void UGridlyTask_DownloadLocalizedTexts::ResumeFromCheckpoint(int& OutViewIdIndex, int& OutOffset)
+{
+	OutViewIdIndex = 0;
+	OutOffset = 0;
+	bVerifyCheckpoint = false;
+
+	const TArray<FGridlyDownloadCheckpoint::FPage>& Pages = Checkpoint.GetPages();
+	for (const FGridlyDownloadCheckpoint::FPage& Page : Pages)
+	{
+		FString Content;
+		TArray<FGridlyTableRow> TableRows;
+		if (!ViewIds.IsValidIndex(Page.ViewIndex) || ViewIds[Page.ViewIndex] != Page.ViewId || !Checkpoint.LoadPage(Page, Content)
+			|| !FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0))
+		{
+			UE_LOG(LogGridly, Warning, TEXT("Could not read checkpointed page at offset %d of view %s, starting over"), Page.Offset,
+				*Page.ViewId);
+			Checkpoint.Discard();
+			TextRecords.Reset(FGridlyCultureConverter::GetTargetCultures());
+			TotalCount = 0;
+			OutViewIdIndex = 0;
+			OutOffset = 0;
+			return;
+		}
+
+		TextRecords.AppendTableRows(TableRows);
+		TotalCount += Page.Offset == 0 ? Page.TotalCount : 0;
+
+		const bool bViewComplete = Page.Offset + Page.Limit >= Page.TotalCount;
+		OutViewIdIndex = bViewComplete ? Page.ViewIndex + 1 : Page.ViewIndex;
+		OutOffset = bViewComplete ? 0 : Page.Offset + Page.Limit;
+	}
+
+	if (Pages.Num() > 0)
+	{
+		bVerifyCheckpoint = OutViewIdIndex < ViewIds.Num();
+		UE_LOG(LogGridly, Log, TEXT("Resuming run %s from %d checkpointed pages with %d records, at offset %d of view %d"),
+			*Checkpoint.GetRunId(), Pages.Num(), TextRecords.Num(), OutOffset, OutViewIdIndex);
+	}
 }
 
 void UGridlyTask_DownloadLocalizedTexts::RequestPage(const int ViewIdIndex, const int Offset)
 {
+	if (CancellationToken.IsCancelled())
+	{
+		Cancel();
+		return;
+	}
+
 	CurrentViewIdIndex = ViewIdIndex;
 	CurrentOffset = Offset;
 
@@ -52,9 +116,7 @@ void UGridlyTask_DownloadLocalizedTexts::RequestPage(const int ViewIdIndex, cons
 	{
 		const FGridlyResult FailResult = FGridlyResult{"Unable to import texts: no view IDs were specified"};
 		UE_LOG(LogGridly, Error, TEXT("%s"), *FailResult.Message);
-		OnFail.Broadcast(PolyglotTextDatas, 1.f, FailResult);
-		if (OnFailDelegate.IsBound())
-			OnFailDelegate.Execute(PolyglotTextDatas, FailResult);
+		BroadcastFail(FailResult);
 		return;
 	}
 
@@ -65,59 +127,93 @@ void UGridlyTask_DownloadLocalizedTexts::RequestPage(const int ViewIdIndex, cons
 		const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 		const FString ApiKey = GameSettings->ImportApiKey;
 
-		const FString PaginationSettings =
-			FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("{\"offset\":%d,\"limit\":%d}"), Offset, Limit));
-
-		FStringFormatNamedArguments Args;
-		Args.Add(TEXT("ViewId"), *ViewId);
-		Args.Add(TEXT("PaginationSettings"), *PaginationSettings);
-		const FString Url = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/records?page={PaginationSettings}"),
-			Args);
+		const FString Url = FGridlyApi::GetRecordsUrl(ViewId, Offset, Limit, ColumnIds);
 
-		HttpRequest = FHttpModule::Get().CreateRequest();
-		HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-
-		HttpRequest->SetVerb(TEXT("GET"));
-		HttpRequest->SetURL(Url);
+		HttpRequest = FGridlyApi::CreateRequest(TEXT("GET"), Url, ApiKey);
 
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UGridlyTask_DownloadLocalizedTexts::OnProcessRequestComplete);
 
-		OnProgress.Broadcast(PolyglotTextDatas, .1f, FGridlyResult::Success);
-		if (OnProgressDelegate.IsBound())
-			OnProgressDelegate.Execute(PolyglotTextDatas, .1f);
+		BroadcastProgress(.1f, TextRecords.Num());
 
 		// Throttles number of requests by sleeping between each
 
 		UWorld* World = WorldContextObject != nullptr ? WorldContextObject->GetWorld() : nullptr;
-		if (World)
+		if (!bThrottleRequests)
+		{
+			FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+			UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
+		}
+		else if (World)
 		{
 			FTimerHandle TimerHandle;
-			World->GetTimerManager().SetTimer(TimerHandle, [this, ViewId, Offset]()
+			World->GetTimerManager().SetTimer(TimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, ViewId, Offset]()
 			{
-				HttpRequest->ProcessRequest();
-				UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
-			}, 1.f, false);
+				// The task may have been cancelled while waiting
+				if (HttpRequest.IsValid())
+				{
+					FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+					UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
+				}
+			}), 1.f, false);
 		}
 		else
 		{
-			HttpRequest->ProcessRequest();
-			UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
-			FPlatformProcess::Sleep(1.f);
+			// Without a world, wait on the core ticker so the calling thread is never blocked
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, ViewId, Offset](float)
+			{
+				// The task may have been cancelled while waiting
+				if (HttpRequest.IsValid())
+				{
+					FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+					UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
+				}
+				return false;
+			}), 1.f);
 		}
 	}
 	else
 	{
-		OnSuccess.Broadcast(PolyglotTextDatas, 1.f, FGridlyResult::Success);
+		Checkpoint.Complete();
+
+		if (OnRecordStoreSuccessDelegate.IsBound())
+			OnRecordStoreSuccessDelegate.Execute(TextRecords);
+		if (OnSuccess.IsBound())
+			OnSuccess.Broadcast(GetPolyglotTextDatas(), 1.f, FGridlyResult::Success);
 		if (OnSuccessDelegate.IsBound())
-			OnSuccessDelegate.Execute(PolyglotTextDatas);
+			OnSuccessDelegate.Execute(GetPolyglotTextDatas());
+
+		Finish();
+	}
+}
+
+void UGridlyTask_DownloadLocalizedTexts::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (HttpRequest.IsValid())
+	{
+		HttpRequest->OnProcessRequestComplete().Unbind();
+		HttpRequest->CancelRequest();
 	}
+
+	UE_LOG(LogGridly, Log, TEXT("Cancelled downloading texts"));
+	BroadcastFail(FGridlyResult{"Download was cancelled"});
 }
 
 void UGridlyTask_DownloadLocalizedTexts::OnProcessRequestComplete(FHttpRequestPtr HttpRequestPtr,
 	FHttpResponsePtr HttpResponsePtr, bool bSuccess)
 {
+	GRIDLY_PERF_HTTP(Import, HttpRequestPtr, HttpResponsePtr);
+
+	if (CancellationToken.IsCancelled())
+	{
+		Cancel();
+		return;
+	}
+
 	if (bSuccess && HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Ok)
 	{
 		// Header
@@ -128,58 +224,191 @@ void UGridlyTask_DownloadLocalizedTexts::OnProcessRequestComplete(FHttpRequestPt
 			UE_LOG(LogGridly, Verbose, TEXT("%s"), *Headers[i]);
 		}
 
+		const int ViewIdTotalCount = FCString::Atoi(*HttpResponsePtr->GetHeader("X-Total-Count"));
+
+		// Checkpointed pages are only kept if the view still has as many records as when they were downloaded
+		if (bVerifyCheckpoint)
+		{
+			bVerifyCheckpoint = false;
+			if (!Checkpoint.IsConsistent(ViewIds[CurrentViewIdIndex], ViewIdTotalCount))
+			{
+				UE_LOG(LogGridly, Warning, TEXT("View %s changed since it was checkpointed, starting over"), *ViewIds[CurrentViewIdIndex]);
+				Checkpoint.Discard();
+				Activate();
+				return;
+			}
+		}
+
 		// Convert from JSON to texts
 
-		const FString Content = HttpResponsePtr->GetContentAsString();
+		FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 		UE_LOG(LogGridly, Verbose, TEXT("%s"), *Content);
 
-		TMap<FString, FPolyglotTextData> PolyglotTextDataMap;
-		TArray<FGridlyTableRow> TableRows;
+		const int32 NumContentBytes = HttpResponsePtr->GetContent().Num();
+		const float ElapsedTime = HttpRequestPtr->GetElapsedTime();
 
-		if (FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0)
-		    && FGridlyLocalizedTextConverter::TableRowsToPolyglotTextDatas(TableRows, PolyglotTextDataMap))
+		// Commandlets have no frame to keep responsive and do not pump game thread tasks, so they parse in place
+		if (IsRunningCommandlet() || !FPlatformProcess::SupportsMultithreading())
 		{
-			TArray<FPolyglotTextData> CurrentPolyglotTextDatas;
-			PolyglotTextDataMap.GenerateValueArray(CurrentPolyglotTextDatas);
-			PolyglotTextDatas.Append(CurrentPolyglotTextDatas);
-
-			const int ViewIdTotalCount = FCString::Atoi(*HttpResponsePtr->GetHeader("X-Total-Count"));
-			TotalCount += CurrentOffset == 0 ? ViewIdTotalCount : 0;
-			const float EstimatedProgressViewIds =
-				static_cast<float>(CurrentViewIdIndex) / static_cast<float>(FMath::Max(1, ViewIds.Num()));
-			const float EstimatedProgressPagination = static_cast<float>(PolyglotTextDatas.Num()) / static_cast<float>(TotalCount);
-			const float EstimatedProgress = (EstimatedProgressViewIds + EstimatedProgressPagination) / 2.f;
-			
-			OnProgress.Broadcast(PolyglotTextDatas, EstimatedProgress, FGridlyResult::Success);
-			if (OnProgressDelegate.IsBound())
-				OnProgressDelegate.Execute(PolyglotTextDatas, EstimatedProgress);
-
-			if ((CurrentOffset + Limit) < TotalCount)
+			TArray<FGridlyTableRow> TableRows;
+			bool bParsed;
 			{
-				RequestPage(CurrentViewIdIndex, CurrentOffset + Limit);
+				GRIDLY_PERF_SCOPE(Import, Parse);
+				bParsed = FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0);
 			}
-			else
+			OnPageParsed(bParsed, TableRows, Content, ViewIdTotalCount, NumContentBytes, ElapsedTime);
+			return;
+		}
+
+		// Elsewhere the page is parsed on a worker thread and only the records are added on the game thread
+		const TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts> WeakThis = this;
+		Async(EAsyncExecution::ThreadPool,
+			[WeakThis, Content = MoveTemp(Content), ViewIdTotalCount, NumContentBytes, ElapsedTime]() mutable
 			{
-				RequestPage(CurrentViewIdIndex + 1, 0);
-			}
+				TArray<FGridlyTableRow> TableRows;
+				bool bParsed;
+				{
+					GRIDLY_PERF_SCOPE(Import, Parse);
+					bParsed = FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0);
+				}
+
+				AsyncTask(ENamedThreads::GameThread,
+					[WeakThis, bParsed, TableRows = MoveTemp(TableRows), Content = MoveTemp(Content), ViewIdTotalCount, NumContentBytes,
+					ElapsedTime]()
+					{
+						if (UGridlyTask_DownloadLocalizedTexts* Task = WeakThis.Get())
+						{
+							Task->OnPageParsed(bParsed, TableRows, Content, ViewIdTotalCount, NumContentBytes, ElapsedTime);
+						}
+					});
+			});
+	}
+	else
+	{
+		const FGridlyResult FailResult = FGridlyResult{"Failed to connect to Gridly"};
+		BroadcastFail(FailResult);
+	}
+}
+
+void UGridlyTask_DownloadLocalizedTexts::OnPageParsed(bool bParsed, const TArray<FGridlyTableRow>& TableRows, const FString& Content,
+	int ViewIdTotalCount, int32 NumContentBytes, float ElapsedTime)
+{
+	// Cancelled or failed while the page was parsed
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (CancellationToken.IsCancelled())
+	{
+		Cancel();
+		return;
+	}
+
+	const int32 FirstPageRecordIndex = TextRecords.Num();
+	int32 NumAppendedRecords = 0;
+	if (bParsed)
+	{
+		GRIDLY_PERF_SCOPE(Import, Convert);
+		NumAppendedRecords = TextRecords.AppendTableRows(TableRows);
+		FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::Import, NumAppendedRecords);
+	}
+
+	if (NumAppendedRecords > 0)
+	{
+		TotalCount += CurrentOffset == 0 ? ViewIdTotalCount : 0;
+		const float EstimatedProgressViewIds =
+			static_cast<float>(CurrentViewIdIndex) / static_cast<float>(FMath::Max(1, ViewIds.Num()));
+		const float EstimatedProgressPagination = static_cast<float>(TextRecords.Num()) / static_cast<float>(TotalCount);
+		const float EstimatedProgress = (EstimatedProgressViewIds + EstimatedProgressPagination) / 2.f;
+
+		BroadcastProgress(EstimatedProgress, FirstPageRecordIndex);
+
+		// The next page starts after this one, whatever size the next page gets
+		const int PageLimit = Limit;
+		BatchSizer.AddSample(TableRows.Num(), NumContentBytes, ElapsedTime);
+		Limit = BatchSizer.GetBatchSize();
+
+		Checkpoint.AddPage(CurrentViewIdIndex, ViewIds[CurrentViewIdIndex], CurrentOffset, PageLimit, ViewIdTotalCount, Content);
+
+		if ((CurrentOffset + PageLimit) < TotalCount)
+		{
+			RequestPage(CurrentViewIdIndex, CurrentOffset + PageLimit);
 		}
 		else
 		{
-			const FGridlyResult FailResult = FGridlyResult{"Failed to parse downloaded content"};
-			OnFail.Broadcast(PolyglotTextDatas, 1.f, FailResult);
-			if (OnFailDelegate.IsBound())
-				OnFailDelegate.Execute(PolyglotTextDatas, FailResult);
+			RequestPage(CurrentViewIdIndex + 1, 0);
 		}
 	}
 	else
 	{
-		const FGridlyResult FailResult = FGridlyResult{"Failed to connect to Gridly"};
-		OnFail.Broadcast(PolyglotTextDatas, 1.f, FailResult);
-		if (OnFailDelegate.IsBound())
-			OnFailDelegate.Execute(PolyglotTextDatas, FailResult);
+		const FGridlyResult FailResult = FGridlyResult{"Failed to parse downloaded content"};
+		BroadcastFail(FailResult);
 	}
 }
 
+void UGridlyTask_DownloadLocalizedTexts::BroadcastProgress(float Progress, int32 FirstPageRecordIndex)
+{
+	if (!OnProgress.IsBound() && !OnProgressDelegate.IsBound())
+	{
+		return;
+	}
+
+	// Only the new page is expanded, so progress costs the same on every page however many texts came before
+	PagePolyglotTextDatas.Reset();
+	TextRecords.AppendPolyglotTextDatas(PagePolyglotTextDatas, FirstPageRecordIndex);
+
+	if (OnProgress.IsBound())
+		OnProgress.Broadcast(PagePolyglotTextDatas, Progress, FGridlyResult::Success);
+	if (OnProgressDelegate.IsBound())
+	{
+		FGridlyDownloadProgress DownloadProgress;
+		DownloadProgress.NumRecords = TextRecords.Num();
+		DownloadProgress.NumPageRecords = PagePolyglotTextDatas.Num();
+		DownloadProgress.TotalCount = TotalCount;
+		DownloadProgress.ViewIndex = CurrentViewIdIndex;
+		DownloadProgress.NumViews = ViewIds.Num();
+		DownloadProgress.Progress = Progress;
+		OnProgressDelegate.Execute(PagePolyglotTextDatas, DownloadProgress);
+	}
+}
+
+void UGridlyTask_DownloadLocalizedTexts::BroadcastFail(const FGridlyResult& FailResult)
+{
+	if (OnFail.IsBound())
+		OnFail.Broadcast(GetPolyglotTextDatas(), 1.f, FailResult);
+	if (OnFailDelegate.IsBound())
+		OnFailDelegate.Execute(GetPolyglotTextDatas(), FailResult);
+
+	Finish();
+}
+
+void UGridlyTask_DownloadLocalizedTexts::Finish()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	// The request is only dropped, not unbound, as this may run inside its completion delegate
+	HttpRequest.Reset();
+	TextRecords = FGridlyTextRecordStore();
+	PolyglotTextDatas.Empty();
+	PagePolyglotTextDatas.Empty();
+
+	RemoveFromRoot();
+	SetReadyToDestroy();
+}
+
+const TArray<FPolyglotTextData>& UGridlyTask_DownloadLocalizedTexts::GetPolyglotTextDatas()
+{
+	// Records are only ever appended, so earlier conversions stay valid
+	TextRecords.AppendPolyglotTextDatas(PolyglotTextDatas, PolyglotTextDatas.Num());
+	return PolyglotTextDatas;
+}
+
 UGridlyTask_DownloadLocalizedTexts* UGridlyTask_DownloadLocalizedTexts::DownloadLocalizedTexts(const UObject* WorldContextObject)
 {
 	const auto DownloadLocalizedTexts = NewObject<UGridlyTask_DownloadLocalizedTexts>();
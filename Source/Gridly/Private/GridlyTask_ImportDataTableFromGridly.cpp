@@ -5,10 +5,14 @@
 #include "Engine/EngineTypes.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "Containers/Ticker.h"
 #include "GridlyDataTableImporterJSON.h"
 #include "Gridly.h"
+#include "GridlyApi.h"
 #include "GridlyGameSettings.h"
+#include "GridlyStats.h"
 #include "GridlyTableRow.h"
+#include "GridlyTableRowSegment.h"
 #include "HttpModule.h"
 #include "JsonObjectConverter.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
@@ -26,7 +30,8 @@ void UGridlyTask_ImportDataTableFromGridly::Activate()
 {
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 
-	Limit = GameSettings->ImportMaxRecordsPerRequest;
+	BatchSizer.Reset(GameSettings->ImportMaxRecordsPerRequest);
+	Limit = BatchSizer.GetBatchSize();
 	TotalCount = 0;
 
 	ViewIds.Reset();
@@ -42,6 +47,12 @@ void UGridlyTask_ImportDataTableFromGridly::Activate()
 
 void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, const int Offset)
 {
+	if (CancellationToken.IsCancelled())
+	{
+		Cancel();
+		return;
+	}
+
 	CurrentViewIdIndex = ViewIdIndex;
 	CurrentOffset = Offset;
 
@@ -49,9 +60,7 @@ void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, c
 	{
 		const FGridlyResult FailResult = FGridlyResult{"Unable to import data table: no view IDs were specified"};
 		UE_LOG(LogGridly, Error, TEXT("%s"), *FailResult.Message);
-		OnFail.Broadcast(GridlyTableRows, 1.f, FailResult);
-		if (OnFailDelegate.IsBound())
-			OnFailDelegate.Execute(GridlyTableRows, FailResult);
+		BroadcastFail(FailResult);
 		return;
 	}
 
@@ -62,29 +71,13 @@ void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, c
 		const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 		const FString ApiKey = GameSettings->ImportApiKey;
 
-		const FString PaginationSettings = FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("{\"offset\":%d,\"limit\":%d}"),
-			Offset,
-			Limit));
-
-		FStringFormatNamedArguments Args;
-		Args.Add(TEXT("ViewId"), *ViewId);
-		Args.Add(TEXT("PaginationSettings"), *PaginationSettings);
-		const FString Url = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/records?page={PaginationSettings}"),
-			Args);
+		const FString Url = FGridlyApi::GetRecordsUrl(ViewId, Offset, Limit);
 
-		HttpRequest = FHttpModule::Get().CreateRequest();
-		HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-
-		HttpRequest->SetVerb(TEXT("GET"));
-		HttpRequest->SetURL(Url);
+		HttpRequest = FGridlyApi::CreateRequest(TEXT("GET"), Url, ApiKey);
 
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UGridlyTask_ImportDataTableFromGridly::OnProcessRequestComplete);
 
-		OnProgress.Broadcast(GridlyTableRows, .1f, FGridlyResult::Success);
-		if (OnProgressDelegate.IsBound())
-			OnProgressDelegate.Execute(GridlyTableRows, .1f);
+		BroadcastProgress(TArray<FGridlyTableRow>(), .1f);
 
 		// Throttles number of requests by sleeping between each
 
@@ -92,50 +85,97 @@ void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, c
 		if (World)
 		{
 			FTimerHandle TimerHandle;
-			World->GetTimerManager().SetTimer(TimerHandle, [this, ViewId, Offset]()
+			World->GetTimerManager().SetTimer(TimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, ViewId, Offset]()
 			{
-				HttpRequest->ProcessRequest();
-				UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
-			}, 1.f, false);
+				// The task may have been cancelled while waiting
+				if (HttpRequest.IsValid())
+				{
+					FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+					UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
+				}
+			}), 1.f, false);
 		}
 		else
 		{
-			HttpRequest->ProcessRequest();
-			UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
-			FPlatformProcess::Sleep(1.f);
+			// Without a world, wait on the core ticker so the calling thread is never blocked
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, ViewId, Offset](float)
+			{
+				// The task may have been cancelled while waiting
+				if (HttpRequest.IsValid())
+				{
+					FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+					UE_LOG(LogGridly, Log, TEXT("Requesting view ID: %s, with offset: %d, limit: %d"), *ViewId, Offset, Limit);
+				}
+				return false;
+			}), 1.f);
 		}
 	}
 	else
 	{
-		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		TArray<FString> OutProblems;
+		FGridlyDataTableImporterJSON Importer(*GridlyDataTable, GridlyTableRows, OutProblems);
+		FGridlyDataTableImportChanges Changes;
 
-		for (int i = 0; i < GridlyTableRows.Num(); i++)
+		bool bImported;
+		bool bTableChanged = false;
+		bool bRowListChanged = true;
 		{
-			const TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-			JsonObject->SetStringField("name", GridlyTableRows[i].Id);
-
-			for (int j = 0; j < GridlyTableRows[i].Cells.Num(); j++)
+			GRIDLY_PERF_SCOPE(DataTable, Convert);
+			if (GridlyDataTable->bImportChangesOnly)
 			{
-				JsonObject->SetStringField("_path", GridlyTableRows[i].Path);
-				JsonObject->SetStringField(GridlyTableRows[i].Cells[j].ColumnId, GridlyTableRows[i].Cells[j].Value);
+				bImported = Importer.ReadTableAsDiff(Changes,
+					[this, &bTableChanged, &bRowListChanged](const FGridlyDataTableImportChanges& DiffChanges)
+					{
+						bTableChanged = true;
+						bRowListChanged = DiffChanges.AddedRows.Num() > 0 || DiffChanges.RemovedRows.Num() > 0;
+						OnPreTableChangeDelegate.ExecuteIfBound(bRowListChanged);
+					});
+			}
+			else
+			{
+				bTableChanged = true;
+				OnPreTableChangeDelegate.ExecuteIfBound(bRowListChanged);
+				GridlyDataTable->EmptyTable();
+				bImported = Importer.ReadTable();
 			}
-
-			JsonValues.Add(MakeShareable(new FJsonValueObject(JsonObject)));
 		}
 
-		GridlyDataTable->EmptyTable();
-
-		FString JsonString;
-		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonStringWriter<>::Create(&JsonString);
-		FJsonSerializer::Serialize(JsonValues, JsonWriter);
+		if (bTableChanged)
+		{
+			OnPostTableChangeDelegate.ExecuteIfBound(bRowListChanged);
+		}
+		FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::DataTable, GridlyTableRows.Num());
 
-		TArray<FString> OutProblems;
-		if (FGridlyDataTableImporterJSON(*GridlyDataTable, JsonString, OutProblems).ReadTable())
+		if (bImported)
 		{
 			UE_LOG(LogGridly, Log, TEXT("Imported data table from Gridly: %s"), *GridlyDataTable->GetName());
-			OnSuccess.Broadcast(GridlyTableRows, 1.f, FGridlyResult::Success);
-			if (OnSuccessDelegate.IsBound())
-				OnSuccessDelegate.Execute(GridlyTableRows);
+			if (GridlyDataTable->bImportChangesOnly)
+			{
+				LogImportChanges(Changes);
+			}
+			if (OnSegmentSuccessDelegate.IsBound())
+				OnSegmentSuccessDelegate.Execute(GridlyTableRows);
+
+			if (OnSuccess.IsBound() || OnSuccessDelegate.IsBound())
+			{
+				// Spilled rows are only read back when a delegate wants every row at once
+				TArray<FGridlyTableRow> AllRows;
+				if (GridlyTableRows.IsSpilled())
+				{
+					AllRows.Reserve(GridlyTableRows.Num());
+					GridlyTableRows.ForEachPage([&AllRows](const TArray<FGridlyTableRow>& Page)
+					{
+						AllRows.Append(Page);
+					});
+				}
+
+				const TArray<FGridlyTableRow>& SuccessRows = GridlyTableRows.IsSpilled() ? AllRows : GridlyTableRows.GetRowsInMemory();
+				OnSuccess.Broadcast(SuccessRows, 1.f, FGridlyResult::Success);
+				if (OnSuccessDelegate.IsBound())
+					OnSuccessDelegate.Execute(SuccessRows);
+			}
+
+			Finish();
 		}
 		else
 		{
@@ -145,9 +185,7 @@ void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, c
 			}
 
 			const FGridlyResult FailResult = FGridlyResult{"Failed to parse downloaded content"};
-			OnFail.Broadcast(GridlyTableRows, 1.f, FailResult);
-			if (OnFailDelegate.IsBound())
-				OnFailDelegate.Execute(GridlyTableRows, FailResult);
+			BroadcastFail(FailResult);
 		}
 	}
 }
@@ -155,6 +193,14 @@ void UGridlyTask_ImportDataTableFromGridly::RequestPage(const int ViewIdIndex, c
 void UGridlyTask_ImportDataTableFromGridly::OnProcessRequestComplete(FHttpRequestPtr HttpRequestPtr,
 	FHttpResponsePtr HttpResponsePtr, bool bSuccess)
 {
+	GRIDLY_PERF_HTTP(DataTable, HttpRequestPtr, HttpResponsePtr);
+
+	if (CancellationToken.IsCancelled())
+	{
+		Cancel();
+		return;
+	}
+
 	if (bSuccess && HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Ok)
 	{
 		// Header
@@ -167,29 +213,39 @@ void UGridlyTask_ImportDataTableFromGridly::OnProcessRequestComplete(FHttpReques
 
 		// Convert from JSON to texts
 
-		const FString Content = HttpResponsePtr->GetContentAsString();
+		const FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 		UE_LOG(LogGridly, Verbose, TEXT("%s"), *Content);
 
 		TArray<FGridlyTableRow> TableRows;
-
-		if (FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0))
+		bool bParsed;
 		{
-			GridlyTableRows.Append(TableRows);
+			GRIDLY_PERF_SCOPE(DataTable, Parse);
+			bParsed = FJsonObjectConverter::JsonArrayStringToUStruct(Content, &TableRows, 0, 0);
+		}
 
+		if (bParsed)
+		{
 			const int ViewIdTotalCount = FCString::Atoi(*HttpResponsePtr->GetHeader("X-Total-Count"));
 			TotalCount += CurrentOffset == 0 ? ViewIdTotalCount : 0;
 			const float EstimatedProgressViewIds =
 				static_cast<float>(CurrentViewIdIndex) / static_cast<float>(FMath::Max(1, ViewIds.Num()));
-			const float EstimatedProgressPagination = static_cast<float>(GridlyTableRows.Num()) / static_cast<float>(TotalCount);
+			const float EstimatedProgressPagination =
+				static_cast<float>(GridlyTableRows.Num() + TableRows.Num()) / static_cast<float>(TotalCount);
 			const float EstimatedProgress = (EstimatedProgressViewIds + EstimatedProgressPagination) / 2.f;
 
-			OnProgress.Broadcast(GridlyTableRows, EstimatedProgress, FGridlyResult::Success);
-			if (OnProgressDelegate.IsBound())
-				OnProgressDelegate.Execute(GridlyTableRows, EstimatedProgress);
+			// Progress delegates get the page before it joins the other rows
+			const int32 NumPageRows = TableRows.Num();
+			BroadcastProgress(TableRows, EstimatedProgress);
+			GridlyTableRows.AppendPage(MoveTemp(TableRows));
 
-			if ((CurrentOffset + Limit) < TotalCount)
+			// The next page starts after this one, whatever size the next page gets
+			const int PageLimit = Limit;
+			BatchSizer.AddSample(NumPageRows, HttpResponsePtr->GetContent().Num(), HttpRequestPtr->GetElapsedTime());
+			Limit = BatchSizer.GetBatchSize();
+
+			if ((CurrentOffset + PageLimit) < TotalCount)
 			{
-				RequestPage(CurrentViewIdIndex, CurrentOffset + Limit);
+				RequestPage(CurrentViewIdIndex, CurrentOffset + PageLimit);
 			}
 			else
 			{
@@ -199,17 +255,94 @@ void UGridlyTask_ImportDataTableFromGridly::OnProcessRequestComplete(FHttpReques
 		else
 		{
 			const FGridlyResult FailResult = FGridlyResult{"Failed to parse downloaded content"};
-			OnFail.Broadcast(GridlyTableRows, 1.f, FailResult);
-			if (OnFailDelegate.IsBound())
-				OnFailDelegate.Execute(GridlyTableRows, FailResult);
+			BroadcastFail(FailResult);
 		}
 	}
 	else
 	{
 		const FGridlyResult FailResult = FGridlyResult{"Failed to connect to Gridly"};
-		OnFail.Broadcast(GridlyTableRows, 1.f, FailResult);
-		if (OnFailDelegate.IsBound())
-			OnFailDelegate.Execute(GridlyTableRows, FailResult);
+		BroadcastFail(FailResult);
+	}
+}
+
+void UGridlyTask_ImportDataTableFromGridly::BroadcastProgress(const TArray<FGridlyTableRow>& PageRows, float Progress)
+{
+	OnProgress.Broadcast(PageRows, Progress, FGridlyResult::Success);
+	if (OnProgressDelegate.IsBound())
+	{
+		FGridlyDownloadProgress DownloadProgress;
+		DownloadProgress.NumRecords = GridlyTableRows.Num() + PageRows.Num();
+		DownloadProgress.NumPageRecords = PageRows.Num();
+		DownloadProgress.TotalCount = TotalCount;
+		DownloadProgress.ViewIndex = CurrentViewIdIndex;
+		DownloadProgress.NumViews = ViewIds.Num();
+		DownloadProgress.Progress = Progress;
+		OnProgressDelegate.Execute(PageRows, DownloadProgress);
+	}
+}
+
+void UGridlyTask_ImportDataTableFromGridly::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (HttpRequest.IsValid())
+	{
+		HttpRequest->OnProcessRequestComplete().Unbind();
+		HttpRequest->CancelRequest();
+	}
+
+	UE_LOG(LogGridly, Log, TEXT("Cancelled importing data table"));
+	BroadcastFail(FGridlyResult{"Import was cancelled"});
+}
+
+void UGridlyTask_ImportDataTableFromGridly::BroadcastFail(const FGridlyResult& FailResult)
+{
+	OnFail.Broadcast(GridlyTableRows.GetRowsInMemory(), 1.f, FailResult);
+	if (OnFailDelegate.IsBound())
+		OnFailDelegate.Execute(GridlyTableRows.GetRowsInMemory(), FailResult);
+
+	Finish();
+}
+
+void UGridlyTask_ImportDataTableFromGridly::Finish()
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	// The request is only dropped, not unbound, as this may run inside its completion delegate
+	HttpRequest.Reset();
+	GridlyTableRows.Reset();
+
+	RemoveFromRoot();
+	SetReadyToDestroy();
+}
+
+void UGridlyTask_ImportDataTableFromGridly::LogImportChanges(const FGridlyDataTableImportChanges& Changes) const
+{
+	UE_LOG(LogGridly, Log, TEXT("%d rows added, %d rows changed, %d rows removed"), Changes.AddedRows.Num(),
+		Changes.ChangedRows.Num(), Changes.RemovedRows.Num());
+
+	for (const FName& RowName : Changes.AddedRows)
+	{
+		UE_LOG(LogGridly, Verbose, TEXT("Added row: %s"), *RowName.ToString());
+	}
+
+	for (const TPair<FName, TArray<FString>>& ChangedRow : Changes.ChangedRows)
+	{
+		UE_LOG(LogGridly, Log, TEXT("Changed row: %s (%s)"), *ChangedRow.Key.ToString(),
+			*FString::Join(ChangedRow.Value, TEXT(", ")));
+	}
+
+	for (const FName& RowName : Changes.RemovedRows)
+	{
+		UE_LOG(LogGridly, Verbose, TEXT("Removed row: %s"), *RowName.ToString());
 	}
 }
 
@@ -0,0 +1,213 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyApi.h"
+
+#include "Gridly.h"
+#include "GridlyCultureConverter.h"
+#include "GridlyGameSettings.h"
+#include "HttpModule.h"
+#include "Misc/CommandLine.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/Compression.h"
+
+namespace GridlyApi
+{
+	static FString BaseUrlOverride;
+	static TSharedPtr<IGridlyRequestExecutor> RequestExecutor;
+
+	/** Bodies smaller than this are sent uncompressed, as the gzip header would outweigh the savings */
+	static const int32 MinCompressedContentSize = 1024;
+}
+
+const TCHAR* FGridlyApi::DefaultBaseUrl = TEXT("https://api.gridly.com");
+
+FString FGridlyApi::GetBaseUrl()
+{
+	FString BaseUrl = GridlyApi::BaseUrlOverride;
+	if (BaseUrl.IsEmpty() && !FParse::Value(FCommandLine::Get(), TEXT("-GridlyApiUrl="), BaseUrl))
+	{
+		BaseUrl = GetDefault<UGridlyGameSettings>()->ApiBaseUrl;
+	}
+
+	BaseUrl.RemoveFromEnd(TEXT("/"));
+	return BaseUrl.IsEmpty() ? FString(DefaultBaseUrl) : BaseUrl;
+}
+
+void FGridlyApi::SetBaseUrlOverride(const FString& BaseUrl)
+{
+	GridlyApi::BaseUrlOverride = BaseUrl;
+}
+
+FString FGridlyApi::GetViewUrl(const FString& ViewId, const FString& Endpoint)
+{
+	return FString::Printf(TEXT("%s/v1/views/%s/%s"), *GetBaseUrl(), *ViewId, *Endpoint);
+}
+
+FString FGridlyApi::GetRecordsUrl(const FString& ViewId, int32 Offset, int32 Limit, const TArray<FString>& ColumnIds)
+{
+	const FString PaginationSettings =
+		FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("{\"offset\":%d,\"limit\":%d}"), Offset, Limit));
+
+	FString Endpoint = TEXT("records?page=") + PaginationSettings;
+	if (ColumnIds.Num() > 0)
+	{
+		Endpoint += TEXT("&columnIds=") + FGenericPlatformHttp::UrlEncode(FString::Join(ColumnIds, TEXT(",")));
+	}
+
+	return GetViewUrl(ViewId, Endpoint);
+}
+
+TArray<FString> FGridlyApi::GetTextColumnIds(const TArray<FString>& SourceCultures, const TArray<FString>& TargetCultures)
+{
+	const UGridlyGameSettings* GameSettings = GetDefault<UGridlyGameSettings>();
+
+	TArray<FString> ColumnIds;
+	if (!GameSettings->bDownloadOnlyTextColumns)
+	{
+		return ColumnIds;
+	}
+
+	// The path tag comes with every record, and combined IDs carry the namespace in the record ID
+	if (!GameSettings->bUseCombinedNamespaceId && !GameSettings->NamespaceColumnId.IsEmpty()
+		&& GameSettings->NamespaceColumnId != TEXT("path"))
+	{
+		ColumnIds.Add(GameSettings->NamespaceColumnId);
+	}
+
+	const auto AddLanguageColumnIds = [&ColumnIds](const TArray<FString>& Cultures, const FString& Prefix)
+	{
+		for (const FString& Culture : Cultures)
+		{
+			FString GridlyCulture;
+			if (FGridlyCultureConverter::ConvertToGridly(Culture, GridlyCulture))
+			{
+				ColumnIds.AddUnique(Prefix + GridlyCulture);
+			}
+		}
+	};
+	AddLanguageColumnIds(SourceCultures, GameSettings->SourceLanguageColumnIdPrefix);
+	AddLanguageColumnIds(TargetCultures, GameSettings->TargetLanguageColumnIdPrefix);
+
+	return ColumnIds;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FGridlyApi::CreateRequest(const FString& Verb, const FString& Url,
+	const FString& ApiKey)
+{
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = GridlyApi::RequestExecutor.IsValid()
+		? GridlyApi::RequestExecutor->CreateRequest()
+		: FHttpModule::Get().CreateRequest();
+
+	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
+	if (GetDefault<UGridlyGameSettings>()->bCompressTransfers)
+	{
+		HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
+	}
+	HttpRequest->SetVerb(Verb);
+	HttpRequest->SetURL(Url);
+
+	return HttpRequest;
+}
+
+bool FGridlyApi::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+{
+	return GridlyApi::RequestExecutor.IsValid() ? GridlyApi::RequestExecutor->ProcessRequest(Request) : Request->ProcessRequest();
+}
+
+void FGridlyApi::SetRequestExecutor(const TSharedPtr<IGridlyRequestExecutor>& RequestExecutor)
+{
+	GridlyApi::RequestExecutor = RequestExecutor;
+}
+
+void FGridlyApi::SetContent(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FString& Content)
+{
+	const FTCHARToUTF8 Utf8Content(*Content, Content.Len());
+	const uint8* Data = reinterpret_cast<const uint8*>(Utf8Content.Get());
+
+	if (GetDefault<UGridlyGameSettings>()->bCompressTransfers && Utf8Content.Length() >= GridlyApi::MinCompressedContentSize)
+	{
+		TArray<uint8> CompressedContent;
+		if (GzipCompress(Data, Utf8Content.Length(), CompressedContent))
+		{
+			UE_LOG(LogGridly, Verbose, TEXT("Compressed request body from %d to %d bytes"), Utf8Content.Length(),
+				CompressedContent.Num());
+			Request->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+			Request->SetContent(MoveTemp(CompressedContent));
+			return;
+		}
+	}
+
+	Request->SetContent(TArray<uint8>(Data, Utf8Content.Length()));
+}
+
+FString FGridlyApi::GetContentAsString(const FHttpResponsePtr& Response)
+{
+	if (!Response.IsValid())
+	{
+		return FString();
+	}
+
+	// Some HTTP backends decode gzip responses themselves, so only what still starts with the gzip magic bytes is decompressed
+	const TArray<uint8>& Content = Response->GetContent();
+	if (IsGzipCompressed(Content))
+	{
+		TArray<uint8> Data;
+		if (GzipUncompress(Content, Data))
+		{
+			UE_LOG(LogGridly, Verbose, TEXT("Decompressed response body from %d to %d bytes"), Content.Num(), Data.Num());
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+			return FString(FStringView(Converted.Get(), Converted.Length()));
+		}
+
+		UE_LOG(LogGridly, Warning, TEXT("Unable to decompress response from: %s"), *Response->GetURL());
+	}
+
+	return Response->GetContentAsString();
+}
+
+bool FGridlyApi::GzipCompress(const uint8* Data, int32 Size, TArray<uint8>& OutCompressed)
+{
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Size);
+	OutCompressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Gzip, OutCompressed.GetData(), CompressedSize, Data, Size))
+	{
+		OutCompressed.Reset();
+		return false;
+	}
+
+	OutCompressed.SetNum(CompressedSize);
+	return true;
+}
+
+bool FGridlyApi::GzipUncompress(const TArray<uint8>& Compressed, TArray<uint8>& OutData)
+{
+	if (!IsGzipCompressed(Compressed))
+	{
+		return false;
+	}
+
+	// A gzip stream ends with its uncompressed size, little endian
+	const int32 Num = Compressed.Num();
+	const uint32 Size = Compressed[Num - 4] | Compressed[Num - 3] << 8 | Compressed[Num - 2] << 16 | Compressed[Num - 1] << 24;
+	if (Size > static_cast<uint32>(MAX_int32))
+	{
+		return false;
+	}
+
+	OutData.SetNumUninitialized(static_cast<int32>(Size));
+	if (!FCompression::UncompressMemory(NAME_Gzip, OutData.GetData(), OutData.Num(), Compressed.GetData(), Num))
+	{
+		OutData.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FGridlyApi::IsGzipCompressed(const TArray<uint8>& Data)
+{
+	// Header and trailer of a gzip stream alone take 18 bytes
+	return Data.Num() >= 18 && Data[0] == 0x1f && Data[1] == 0x8b;
+}
@@ -0,0 +1,65 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+/** Creates and sends the HTTP requests to the Gridly API, so they can be served from a cache or recorded responses instead */
+class GRIDLY_API IGridlyRequestExecutor
+{
+public:
+	virtual ~IGridlyRequestExecutor() = default;
+
+	virtual TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest() = 0;
+
+	/** Sends the request, its completion delegate must be called exactly once as with IHttpRequest::ProcessRequest */
+	virtual bool ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request) = 0;
+};
+
+/** Where and how requests to the Gridly API are sent */
+class GRIDLY_API FGridlyApi
+{
+public:
+	static const TCHAR* DefaultBaseUrl;
+
+	/**
+	 * Base URL of the API without a trailing slash, e.g. "https://api.gridly.com". Taken from SetBaseUrlOverride, then
+	 * -GridlyApiUrl= on the command line, then the ApiBaseUrl setting
+	 */
+	static FString GetBaseUrl();
+
+	/** Sends every request to another server, such as a local stand-in, until reset with an empty string */
+	static void SetBaseUrlOverride(const FString& BaseUrl);
+
+	/** URL of an endpoint of a view, e.g. GetViewUrl(ViewId, TEXT("records")) */
+	static FString GetViewUrl(const FString& ViewId, const FString& Endpoint);
+
+	/** URL of a page of records of a view. Only the given columns are requested, unless ColumnIds is empty */
+	static FString GetRecordsUrl(const FString& ViewId, int32 Offset, int32 Limit, const TArray<FString>& ColumnIds = TArray<FString>());
+
+	/**
+	 * Columns a text import reads: the namespace column, and the source and target language columns of the given cultures.
+	 * Empty, meaning every column, unless the bDownloadOnlyTextColumns setting is on.
+	 */
+	static TArray<FString> GetTextColumnIds(const TArray<FString>& SourceCultures, const TArray<FString>& TargetCultures);
+
+	/** Creates a JSON request to the API, authorized with ApiKey */
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const FString& Verb, const FString& Url, const FString& ApiKey);
+
+	static bool ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request);
+
+	/** Sets the body of a request as UTF-8, gzip compressed when the bCompressTransfers setting is on */
+	static void SetContent(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, const FString& Content);
+
+	/** Body of a response as a string, decompressed first if it is still gzip encoded */
+	static FString GetContentAsString(const FHttpResponsePtr& Response);
+
+	static bool GzipCompress(const uint8* Data, int32 Size, TArray<uint8>& OutCompressed);
+	static bool GzipUncompress(const TArray<uint8>& Compressed, TArray<uint8>& OutData);
+	static bool IsGzipCompressed(const TArray<uint8>& Data);
+
+	/** Replaces the executor that sends requests over HTTP, until reset with nullptr */
+	static void SetRequestExecutor(const TSharedPtr<IGridlyRequestExecutor>& RequestExecutor);
+};
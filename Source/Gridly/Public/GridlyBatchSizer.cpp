@@ -0,0 +1,80 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyBatchSizer.h"
+
+#include "Gridly.h"
+#include "GridlyGameSettings.h"
+
+namespace GridlyBatchSizer
+{
+	/** Weight of the latest request in the smoothed cost per record, so one unusual page does not swing the batch size */
+	static const double SampleWeight = 0.5;
+}
+
+FGridlyBatchSizer::FGridlyBatchSizer(int32 InMaxBatchSize)
+	: MaxBatchSize(FMath::Max(1, InMaxBatchSize))
+	, BatchSize(MaxBatchSize)
+{
+	// Settings are only read by Reset, as sizers are also constructed with class default objects
+}
+
+void FGridlyBatchSizer::Reset(int32 InMaxBatchSize)
+{
+	const UGridlyGameSettings* GameSettings = GetDefault<UGridlyGameSettings>();
+	bAdaptive = GameSettings->bAdaptiveBatchSizes;
+	TargetBytes = static_cast<int64>(FMath::Max(1, GameSettings->TargetRequestSizeKB)) * 1024;
+	TargetSeconds = FMath::Max(0.1f, GameSettings->TargetRequestSeconds);
+
+	MaxBatchSize = FMath::Max(1, InMaxBatchSize);
+	BatchSize = MaxBatchSize;
+	BytesPerRecord = 0.0;
+	SecondsPerRecord = 0.0;
+}
+
+void FGridlyBatchSizer::AddSample(int32 NumRecords, int64 NumBytes, double Seconds)
+{
+	if (!bAdaptive || NumRecords <= 0)
+	{
+		return;
+	}
+
+	const double SampleBytesPerRecord = static_cast<double>(NumBytes) / NumRecords;
+	const double SampleSecondsPerRecord = Seconds / NumRecords;
+	const bool bFirstSample = BytesPerRecord == 0.0 && SecondsPerRecord == 0.0;
+	BytesPerRecord = bFirstSample
+		? SampleBytesPerRecord
+		: FMath::Lerp(BytesPerRecord, SampleBytesPerRecord, GridlyBatchSizer::SampleWeight);
+	SecondsPerRecord = bFirstSample
+		? SampleSecondsPerRecord
+		: FMath::Lerp(SecondsPerRecord, SampleSecondsPerRecord, GridlyBatchSizer::SampleWeight);
+
+	double IdealBatchSize = MaxBatchSize;
+	if (BytesPerRecord > 0.0)
+	{
+		IdealBatchSize = FMath::Min(IdealBatchSize, TargetBytes / BytesPerRecord);
+	}
+	if (SecondsPerRecord > 0.0)
+	{
+		IdealBatchSize = FMath::Min(IdealBatchSize, TargetSeconds / SecondsPerRecord);
+	}
+
+	// Grow at most twice as large per request, as the next records may be longer than the last ones
+	const int32 NewBatchSize = FMath::Clamp(FMath::FloorToInt32(IdealBatchSize), 1, FMath::Min(MaxBatchSize, BatchSize * 2));
+	if (NewBatchSize != BatchSize)
+	{
+		UE_LOG(LogGridly, Verbose, TEXT("Batch size changed from %d to %d records (%.0f bytes, %.2f ms per record)"), BatchSize,
+			NewBatchSize, BytesPerRecord, SecondsPerRecord * 1000.0);
+		BatchSize = NewBatchSize;
+	}
+}
+
+bool FGridlyBatchSizer::IsFull(int32 NumRecords, int64 NumBytes) const
+{
+	if (NumRecords >= BatchSize)
+	{
+		return true;
+	}
+
+	// A single record over the budget still goes out on its own
+	return bAdaptive && NumRecords > 0 && NumBytes >= TargetBytes;
+}
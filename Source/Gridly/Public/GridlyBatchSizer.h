@@ -0,0 +1,68 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Picks how many records go into each request to the Gridly API. With the bAdaptiveBatchSizes setting on, batches follow
+ * the observed size and response time per record so requests stay near TargetRequestSizeKB and TargetRequestSeconds.
+ * Batches never exceed the maximum they were created with, so the configured limits and the API limit still apply.
+ */
+class GRIDLY_API FGridlyBatchSizer
+{
+public:
+	explicit FGridlyBatchSizer(int32 InMaxBatchSize = 1000);
+
+	/** Starts over at the maximum, forgetting earlier requests, and reads the adaptive settings */
+	void Reset(int32 InMaxBatchSize);
+
+	int32 GetBatchSize() const { return BatchSize; }
+
+	/** Adapts the batch size to a completed request of NumRecords records, NumBytes and Seconds long */
+	void AddSample(int32 NumRecords, int64 NumBytes, double Seconds);
+
+	/** Whether a batch already holding NumRecords records of NumBytes in total should be sent before adding another */
+	bool IsFull(int32 NumRecords, int64 NumBytes) const;
+
+	/** Splits items into consecutive batches, returning how many items go into each. GetItemBytes estimates an item's size */
+	template <typename ItemType, typename GetItemBytesType>
+	TArray<int32> Split(const TArray<ItemType>& Items, GetItemBytesType GetItemBytes) const
+	{
+		TArray<int32> BatchSizes;
+
+		int32 NumRecords = 0;
+		int64 NumBytes = 0;
+		for (const ItemType& Item : Items)
+		{
+			if (IsFull(NumRecords, NumBytes))
+			{
+				BatchSizes.Add(NumRecords);
+				NumRecords = 0;
+				NumBytes = 0;
+			}
+
+			NumRecords++;
+			NumBytes += GetItemBytes(Item);
+		}
+
+		if (NumRecords > 0)
+		{
+			BatchSizes.Add(NumRecords);
+		}
+
+		return BatchSizes;
+	}
+
+private:
+	bool bAdaptive = false;
+	int64 TargetBytes = 0;
+	double TargetSeconds = 0.0;
+
+	int32 MaxBatchSize = 1000;
+	int32 BatchSize = 1000;
+
+	// Smoothed over the requests so far, zero before the first one
+	double BytesPerRecord = 0.0;
+	double SecondsPerRecord = 0.0;
+};
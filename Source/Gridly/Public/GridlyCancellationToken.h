@@ -0,0 +1,29 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Flag for stopping Gridly work in flight. Copies share the flag, so a token handed to tasks, request queues and workers
+ * can be cancelled from wherever the work was started. Work polls IsCancelled at its own safe points.
+ */
+class FGridlyCancellationToken
+{
+public:
+	FGridlyCancellationToken()
+		: State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{}
+
+	void Cancel() { State->bCancelled = true; }
+	bool IsCancelled() const { return State->bCancelled; }
+
+private:
+	struct FState
+	{
+		std::atomic<bool> bCancelled { false };
+	};
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
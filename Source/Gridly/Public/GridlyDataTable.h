@@ -21,4 +21,8 @@ class GRIDLY_API UGridlyDataTable : public UDataTable
 public:
 	UPROPERTY(Category = Gridly, EditDefaultsOnly)
 	FString ViewId;
+
+	/** Only apply rows and properties that changed on Gridly, instead of rebuilding the whole table on import */
+	UPROPERTY(Category = Gridly, EditDefaultsOnly)
+	bool bImportChangesOnly = false;
 };
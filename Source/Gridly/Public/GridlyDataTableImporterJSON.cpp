@@ -6,6 +6,8 @@
 
 #include "Runtime/Launch/Resources/Version.h"
 #include "GridlyDataTable.h"
+#include "GridlyTableRow.h"
+#include "GridlyTableRowSegment.h"
 
 namespace GridlyDataTableJSONUtils
 {
@@ -49,18 +51,63 @@ FString GetKeyFieldName(const UDataTable& InDataTable)
 
 FGridlyDataTableImporterJSON::FGridlyDataTableImporterJSON(UDataTable& InDataTable, const FString& InJSONData, TArray<FString>& OutProblems) :
 	DataTable(&InDataTable),
-	JSONData(InJSONData),
+	JSONData(&InJSONData),
+	TableRows(nullptr),
+	TableRowSegment(nullptr),
+	ImportProblems(OutProblems)
+{
+}
+
+FGridlyDataTableImporterJSON::FGridlyDataTableImporterJSON(UDataTable& InDataTable, const TArray<FGridlyTableRow>& InTableRows,
+	TArray<FString>& OutProblems) :
+	DataTable(&InDataTable),
+	JSONData(nullptr),
+	TableRows(&InTableRows),
+	TableRowSegment(nullptr),
+	ImportProblems(OutProblems)
+{
+}
+
+FGridlyDataTableImporterJSON::FGridlyDataTableImporterJSON(UDataTable& InDataTable, const FGridlyTableRowSegment& InTableRowSegment,
+	TArray<FString>& OutProblems) :
+	DataTable(&InDataTable),
+	JSONData(nullptr),
+	TableRows(nullptr),
+	TableRowSegment(&InTableRowSegment),
 	ImportProblems(OutProblems)
 {
 }
 
 FGridlyDataTableImporterJSON::~FGridlyDataTableImporterJSON()
 {
+	if (DiffScratchRow)
+	{
+		DataTable->RowStruct->DestroyStruct(DiffScratchRow);
+		FMemory::Free(DiffScratchRow);
+	}
+
+	for (const TPair<FName, uint8*>& PendingRow : PendingDiffRows)
+	{
+		DataTable->RowStruct->DestroyStruct(PendingRow.Value);
+		FMemory::Free(PendingRow.Value);
+	}
+}
+
+bool FGridlyDataTableImporterJSON::ReadTableAsDiff(FGridlyDataTableImportChanges& OutChanges,
+	const TFunction<void(const FGridlyDataTableImportChanges&)>& InOnBeforeApply)
+{
+	DiffChanges = &OutChanges;
+	OnBeforeApplyDiff = &InOnBeforeApply;
+	const bool bReadTable = ReadTable();
+	DiffChanges = nullptr;
+	OnBeforeApplyDiff = nullptr;
+
+	return bReadTable;
 }
 
 bool FGridlyDataTableImporterJSON::ReadTable()
 {
-	if (JSONData.IsEmpty())
+	if (JSONData ? JSONData->IsEmpty() : (TableRowSegment ? TableRowSegment->Num() : TableRows->Num()) == 0)
 	{
 		ImportProblems.Add(TEXT("Input data is empty."));
 		return false;
@@ -73,9 +120,16 @@ bool FGridlyDataTableImporterJSON::ReadTable()
 		return false;
 	}
 
+	RowKey = GridlyDataTableJSONUtils::GetKeyFieldName(*DataTable);
+
+	return JSONData ? ReadJSONRows() : ReadTableRows();
+}
+
+bool FGridlyDataTableImporterJSON::ReadJSONRows()
+{
 	TArray<TSharedPtr<FJsonValue>> ParsedTableRows;
 	{
-		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JSONData);
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(*JSONData);
 		if (!FJsonSerializer::Deserialize(JsonReader, ParsedTableRows) || ParsedTableRows.Num() == 0)
 		{
 			ImportProblems.Add(FString::Printf(TEXT("Failed to parse the JSON data. Error: %s"), *JsonReader->GetErrorMessage()));
@@ -83,8 +137,11 @@ bool FGridlyDataTableImporterJSON::ReadTable()
 		}
 	}
 
-	// Empty existing data
-	DataTable->EmptyTable();
+	// Empty existing data, unless only the differences get applied
+	if (!DiffChanges)
+	{
+		DataTable->EmptyTable();
+	}
 
 	// Iterate over rows
 	for (int32 RowIdx = 0; RowIdx < ParsedTableRows.Num(); ++RowIdx)
@@ -103,7 +160,48 @@ bool FGridlyDataTableImporterJSON::ReadTable()
 		}
 	}
 
-	DataTable->Modify(true);
+	EndImport();
+
+	return true;
+}
+
+bool FGridlyDataTableImporterJSON::ReadTableRows()
+{
+	// Empty existing data, unless only the differences get applied
+	if (!DiffChanges)
+	{
+		DataTable->EmptyTable();
+	}
+
+	// Cell values of the current row, indexed like the row struct schema columns
+	TArray<const FString*> ColumnValues;
+	int32 RowIdx = 0;
+
+	const auto ReadPage = [this, &ColumnValues, &RowIdx](const TArray<FGridlyTableRow>& InTableRows)
+	{
+		// Iterate over rows
+		for (const FGridlyTableRow& TableRow : InTableRows)
+		{
+			if (!ReadTableRow(TableRow, RowIdx, ColumnValues))
+			{
+				ImportProblems.Add(FString::Printf(TEXT("Failed to read row '%d'."), RowIdx));
+			}
+			++RowIdx;
+		}
+	};
+
+	if (!TableRowSegment)
+	{
+		ReadPage(*TableRows);
+	}
+	else if (!TableRowSegment->ForEachPage(ReadPage))
+	{
+		// Without every row, a diff would remove the rows that could not be read
+		ImportProblems.Add(TEXT("Failed to read the downloaded rows back from disk."));
+		return false;
+	}
+
+	EndImport();
 
 	return true;
 }
@@ -111,7 +209,6 @@ bool FGridlyDataTableImporterJSON::ReadTable()
 bool FGridlyDataTableImporterJSON::ReadRow(const TSharedRef<FJsonObject>& InParsedTableRowObject, const int32 InRowIdx)
 {
 	// Get row name
-	FString RowKey = GridlyDataTableJSONUtils::GetKeyFieldName(*DataTable);
 	FName RowName = DataTableUtils::MakeValidName(InParsedTableRowObject->GetStringField(RowKey));
 
 	// Check its not 'none'
@@ -122,7 +219,7 @@ bool FGridlyDataTableImporterJSON::ReadRow(const TSharedRef<FJsonObject>& InPars
 	}
 
 	// Check its not a duplicate
-	if (!DataTable->AllowDuplicateRowsOnImport() && DataTable->GetRowMap().Find(RowName) != nullptr)
+	if (!DataTable->AllowDuplicateRowsOnImport() && IsDuplicateRow(RowName))
 	{
 		ImportProblems.Add(FString::Printf(TEXT("Duplicate row name '%s'."), *RowName.ToString()));
 		return false;
@@ -131,7 +228,7 @@ bool FGridlyDataTableImporterJSON::ReadRow(const TSharedRef<FJsonObject>& InPars
 	// Detect any extra fields within the data for this row
 	if (!DataTable->bIgnoreExtraFields)
 	{
-		TArray<FString> TempPropertyImportNames;
+		const FStructSchema& Schema = GetStructSchema(DataTable->RowStruct);
 		for (const TPair<FString, TSharedPtr<FJsonValue>>& ParsedPropertyKeyValuePair : InParsedTableRowObject->Values)
 		{
 			if (ParsedPropertyKeyValuePair.Key == RowKey)
@@ -140,57 +237,38 @@ bool FGridlyDataTableImporterJSON::ReadRow(const TSharedRef<FJsonObject>& InPars
 				continue;
 			}
 
-			FName PropName = DataTableUtils::MakeValidName(ParsedPropertyKeyValuePair.Key);
-			FProperty* ColumnProp = FindFProperty<FProperty>(DataTable->RowStruct, PropName);
-			for (TFieldIterator<FProperty> It(DataTable->RowStruct); It && !ColumnProp; ++It)
-			{
-#if ENGINE_MINOR_VERSION >= 26
-				DataTableUtils::GetPropertyImportNames(*It, TempPropertyImportNames);
-#else
-				TempPropertyImportNames = DataTableUtils::GetPropertyImportNames(*It);
-#endif
-				ColumnProp = TempPropertyImportNames.Contains(ParsedPropertyKeyValuePair.Key) ? *It : nullptr;
-			}
-
-			if (!ColumnProp)
+			if (!Schema.PropertiesByColumnName.Contains(ParsedPropertyKeyValuePair.Key))
 			{
-				ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' cannot be found in struct '%s'."),
-					*PropName.ToString(), *RowName.ToString(), *DataTable->RowStruct->GetName()));
+				const FName PropName = DataTableUtils::MakeValidName(ParsedPropertyKeyValuePair.Key);
+				if (!Schema.PropertiesByColumnName.Contains(PropName.ToString()))
+				{
+					ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' cannot be found in struct '%s'."),
+						*PropName.ToString(), *RowName.ToString(), *DataTable->RowStruct->GetName()));
+				}
 			}
 		}
 	}
 
-	// Allocate data to store information, using UScriptStruct to know its size
-	uint8* RowData = (uint8*) FMemory::Malloc(DataTable->RowStruct->GetStructureSize());
-	DataTable->RowStruct->InitializeStruct(RowData);
-	// And be sure to call DestroyScriptStruct later
+	uint8* RowData = BeginRow(RowName);
 
-	// Add to row map
-	UGridlyDataTable* GridlyDataTable = Cast<UGridlyDataTable>(DataTable);
-	GridlyDataTable->AddRowInternal(RowName, RowData);
+	const bool bReadRow = ReadStruct(InParsedTableRowObject, DataTable->RowStruct, RowName, RowData);
+	EndRow(RowName, RowData);
 
-	return ReadStruct(InParsedTableRowObject, DataTable->RowStruct, RowName, RowData);
+	return bReadRow;
 }
 
 bool FGridlyDataTableImporterJSON::ReadStruct(const TSharedRef<FJsonObject>& InParsedObject, UScriptStruct* InStruct,
 	const FName InRowName, void* InStructData)
 {
 	// Now read in each property
-	TArray<FString> TempPropertyImportNames;
-	for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+	const FStructSchema& Schema = GetStructSchema(InStruct);
+	for (const FStructSchema::FColumn& Column : Schema.Columns)
 	{
-		FProperty* BaseProp = *It;
-		check(BaseProp);
-
-		const FString ColumnName = DataTableUtils::GetPropertyExportName(BaseProp);
+		FProperty* BaseProp = Column.Property;
+		const FString& ColumnName = Column.ExportName;
 
 		TSharedPtr<FJsonValue> ParsedPropertyValue;
-#if ENGINE_MINOR_VERSION >= 26
-		DataTableUtils::GetPropertyImportNames(BaseProp, TempPropertyImportNames);
-#else
-		TempPropertyImportNames = DataTableUtils::GetPropertyImportNames(BaseProp);
-#endif
-		for (const FString& PropertyName : TempPropertyImportNames)
+		for (const FString& PropertyName : Column.ImportNames)
 		{
 			ParsedPropertyValue = InParsedObject->TryGetField(PropertyName);
 			if (ParsedPropertyValue.IsValid())
@@ -201,15 +279,12 @@ bool FGridlyDataTableImporterJSON::ReadStruct(const TSharedRef<FJsonObject>& InP
 
 		if (!ParsedPropertyValue.IsValid())
 		{
-#if WITH_EDITOR
 			// If the structure has specified the property as optional for import (gameplay code likely doing a custom fix-up or parse of that property),
 			// then avoid warning about it
-			static const FName DataTableImportOptionalMetadataKey(TEXT("DataTableImportOptional"));
-			if (BaseProp->HasMetaData(DataTableImportOptionalMetadataKey))
+			if (Column.bImportOptional)
 			{
 				continue;
 			}
-#endif // WITH_EDITOR
 
 			if (!DataTable->bIgnoreMissingFields)
 			{
@@ -259,6 +334,376 @@ bool FGridlyDataTableImporterJSON::ReadStruct(const TSharedRef<FJsonObject>& InP
 	return true;
 }
 
+bool FGridlyDataTableImporterJSON::IsDuplicateRow(const FName InRowName) const
+{
+	// When applying a diff the table still holds the previous rows, so only rows of this import count
+	return DiffChanges ? ImportedRowNames.Contains(InRowName) : DataTable->GetRowMap().Find(InRowName) != nullptr;
+}
+
+uint8* FGridlyDataTableImporterJSON::BeginRow(const FName InRowName)
+{
+	if (DiffChanges)
+	{
+		ImportedRowNames.Add(InRowName);
+
+		// Rows are read into scratch memory first and only merged where they differ
+		if (!DiffScratchRow)
+		{
+			DiffScratchRow = (uint8*) FMemory::Malloc(DataTable->RowStruct->GetStructureSize());
+			DataTable->RowStruct->InitializeStruct(DiffScratchRow);
+		}
+		else
+		{
+			DataTable->RowStruct->ClearScriptStruct(DiffScratchRow);
+		}
+
+		return DiffScratchRow;
+	}
+
+	// Allocate data to store information, using UScriptStruct to know its size
+	uint8* RowData = (uint8*) FMemory::Malloc(DataTable->RowStruct->GetStructureSize());
+	DataTable->RowStruct->InitializeStruct(RowData);
+	// And be sure to call DestroyScriptStruct later
+
+	// Add to row map
+	UGridlyDataTable* GridlyDataTable = Cast<UGridlyDataTable>(DataTable);
+	GridlyDataTable->AddRowInternal(InRowName, RowData);
+
+	return RowData;
+}
+
+void FGridlyDataTableImporterJSON::EndRow(const FName InRowName, uint8* InRowData)
+{
+	if (!DiffChanges)
+	{
+		return;
+	}
+
+	// The table is left alone until every difference is known, see ApplyDiff
+	uint8* const* ExistingRowData = DataTable->GetRowMap().Find(InRowName);
+	TArray<FString> ChangedColumns;
+	if (ExistingRowData)
+	{
+		for (const FStructSchema::FColumn& Column : GetStructSchema(DataTable->RowStruct).Columns)
+		{
+			if (!Column.Property->Identical_InContainer(*ExistingRowData, InRowData))
+			{
+				ChangedColumns.Add(Column.ExportName);
+			}
+		}
+
+		if (ChangedColumns.Num() == 0)
+		{
+			return;
+		}
+	}
+
+	uint8* RowData = (uint8*) FMemory::Malloc(DataTable->RowStruct->GetStructureSize());
+	DataTable->RowStruct->InitializeStruct(RowData);
+	DataTable->RowStruct->CopyScriptStruct(RowData, InRowData);
+	PendingDiffRows.Add(InRowName, RowData);
+
+	if (ExistingRowData)
+	{
+		DiffChanges->ChangedRows.Add(InRowName, MoveTemp(ChangedColumns));
+	}
+	else
+	{
+		DiffChanges->AddedRows.Add(InRowName);
+	}
+}
+
+void FGridlyDataTableImporterJSON::EndImport()
+{
+	if (DiffChanges)
+	{
+		// Remove rows that are no longer on Gridly
+		TArray<FName> RowNames;
+		DataTable->GetRowMap().GenerateKeyArray(RowNames);
+		for (const FName& RowName : RowNames)
+		{
+			if (!ImportedRowNames.Contains(RowName))
+			{
+				DiffChanges->RemovedRows.Add(RowName);
+			}
+		}
+
+		if (!DiffChanges->HasChanges())
+		{
+			return;
+		}
+
+		if (OnBeforeApplyDiff && *OnBeforeApplyDiff)
+		{
+			(*OnBeforeApplyDiff)(*DiffChanges);
+		}
+	}
+
+	DataTable->Modify(true);
+
+	if (DiffChanges)
+	{
+		ApplyDiff();
+	}
+}
+
+void FGridlyDataTableImporterJSON::ApplyDiff()
+{
+	UGridlyDataTable* GridlyDataTable = Cast<UGridlyDataTable>(DataTable);
+
+	for (const FName& RowName : DiffChanges->AddedRows)
+	{
+		GridlyDataTable->AddRowInternal(RowName, PendingDiffRows.FindAndRemoveChecked(RowName));
+	}
+
+	// Only copy the properties that actually changed, so untouched rows stay untouched
+	const FStructSchema& Schema = GetStructSchema(DataTable->RowStruct);
+	for (const TPair<FName, TArray<FString>>& ChangedRow : DiffChanges->ChangedRows)
+	{
+		uint8* RowData = PendingDiffRows.FindAndRemoveChecked(ChangedRow.Key);
+		uint8* ExistingRowData = GridlyDataTable->GetRowMap().FindChecked(ChangedRow.Key);
+		for (const FStructSchema::FColumn& Column : Schema.Columns)
+		{
+			if (ChangedRow.Value.Contains(Column.ExportName))
+			{
+				Column.Property->CopyCompleteValue_InContainer(ExistingRowData, RowData);
+			}
+		}
+
+		DataTable->RowStruct->DestroyStruct(RowData);
+		FMemory::Free(RowData);
+	}
+
+	for (const FName& RowName : DiffChanges->RemovedRows)
+	{
+		GridlyDataTable->RemoveRowInternal(RowName);
+	}
+}
+
+const FGridlyDataTableImporterJSON::FStructSchema& FGridlyDataTableImporterJSON::GetStructSchema(const UScriptStruct* InStruct)
+{
+	if (const TUniquePtr<FStructSchema>* ExistingSchema = StructSchemas.Find(InStruct))
+	{
+		return **ExistingSchema;
+	}
+
+	// Schemas are boxed so references stay valid while nested structs add theirs
+	FStructSchema& Schema = *StructSchemas.Add(InStruct, MakeUnique<FStructSchema>());
+	for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+	{
+		FProperty* BaseProp = *It;
+		check(BaseProp);
+
+		FStructSchema::FColumn& Column = Schema.Columns.AddDefaulted_GetRef();
+		Column.Property = BaseProp;
+		Column.ExportName = DataTableUtils::GetPropertyExportName(BaseProp);
+#if ENGINE_MINOR_VERSION >= 26
+		DataTableUtils::GetPropertyImportNames(BaseProp, Column.ImportNames);
+#else
+		Column.ImportNames = DataTableUtils::GetPropertyImportNames(BaseProp);
+#endif
+#if WITH_EDITOR
+		static const FName DataTableImportOptionalMetadataKey(TEXT("DataTableImportOptional"));
+		Column.bImportOptional = BaseProp->HasMetaData(DataTableImportOptionalMetadataKey);
+#endif // WITH_EDITOR
+
+		Schema.PropertiesByColumnName.Add(BaseProp->GetName(), BaseProp);
+		for (const FString& ImportName : Column.ImportNames)
+		{
+			Schema.PropertiesByColumnName.Add(ImportName, BaseProp);
+		}
+	}
+
+	return Schema;
+}
+
+int32 FGridlyDataTableImporterJSON::FindRowStructColumnIndex(const FString& InColumnName)
+{
+	if (const int32* ExistingIndex = RowStructColumnIndices.Find(InColumnName))
+	{
+		return *ExistingIndex;
+	}
+
+	const FStructSchema& Schema = GetStructSchema(DataTable->RowStruct);
+	FProperty* const* ColumnProp = Schema.PropertiesByColumnName.Find(InColumnName);
+	if (!ColumnProp)
+	{
+		ColumnProp = Schema.PropertiesByColumnName.Find(DataTableUtils::MakeValidName(InColumnName).ToString());
+	}
+
+	const int32 ColumnIndex = ColumnProp
+		? Schema.Columns.IndexOfByPredicate([ColumnProp](const FStructSchema::FColumn& Column) { return Column.Property == *ColumnProp; })
+		: INDEX_NONE;
+	RowStructColumnIndices.Add(InColumnName, ColumnIndex);
+	return ColumnIndex;
+}
+
+bool FGridlyDataTableImporterJSON::ReadTableRow(const FGridlyTableRow& InTableRow, const int32 InRowIdx,
+	TArray<const FString*>& OutColumnValues)
+{
+	static const FString IdFieldName = TEXT("name");
+	static const FString PathFieldName = TEXT("_path");
+
+	const FStructSchema& Schema = GetStructSchema(DataTable->RowStruct);
+	OutColumnValues.Reset(Schema.Columns.Num());
+	OutColumnValues.AddZeroed(Schema.Columns.Num());
+
+	// Same field precedence the records had as JSON objects: record ID and path first, then cells by column ID
+	const FString* RowNameValue = nullptr;
+	bool bHasExtraFields = false;
+	const auto AssignField = [&](const FString& FieldName, const FString& Value)
+	{
+		if (FieldName == RowKey)
+		{
+			RowNameValue = &Value;
+		}
+
+		const int32 ColumnIndex = FindRowStructColumnIndex(FieldName);
+		if (ColumnIndex != INDEX_NONE)
+		{
+			OutColumnValues[ColumnIndex] = &Value;
+		}
+		else if (FieldName != RowKey && !DataTable->bIgnoreExtraFields)
+		{
+			bHasExtraFields = true;
+		}
+	};
+
+	AssignField(IdFieldName, InTableRow.Id);
+	if (InTableRow.Cells.Num() > 0)
+	{
+		AssignField(PathFieldName, InTableRow.Path);
+	}
+	for (const FGridlyTableCell& Cell : InTableRow.Cells)
+	{
+		AssignField(Cell.ColumnId, Cell.Value);
+	}
+
+	// Get row name
+	const FName RowName = RowNameValue ? DataTableUtils::MakeValidName(*RowNameValue) : NAME_None;
+
+	// Check its not 'none'
+	if (RowName.IsNone())
+	{
+		ImportProblems.Add(FString::Printf(TEXT("Row '%d' missing key field '%s'."), InRowIdx, *RowKey));
+		return false;
+	}
+
+	// Check its not a duplicate
+	if (!DataTable->AllowDuplicateRowsOnImport() && IsDuplicateRow(RowName))
+	{
+		ImportProblems.Add(FString::Printf(TEXT("Duplicate row name '%s'."), *RowName.ToString()));
+		return false;
+	}
+
+	// Report extra fields, only walking the row again when there are any
+	if (bHasExtraFields)
+	{
+		const auto ReportExtraField = [&](const FString& FieldName)
+		{
+			if (FieldName != RowKey && FindRowStructColumnIndex(FieldName) == INDEX_NONE)
+			{
+				ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' cannot be found in struct '%s'."),
+					*DataTableUtils::MakeValidName(FieldName).ToString(), *RowName.ToString(), *DataTable->RowStruct->GetName()));
+			}
+		};
+
+		ReportExtraField(IdFieldName);
+		if (InTableRow.Cells.Num() > 0)
+		{
+			ReportExtraField(PathFieldName);
+		}
+		for (const FGridlyTableCell& Cell : InTableRow.Cells)
+		{
+			ReportExtraField(Cell.ColumnId);
+		}
+	}
+
+	uint8* RowData = BeginRow(RowName);
+
+	// Now read in each property
+	bool bReadRow = true;
+	for (int32 ColumnIndex = 0; ColumnIndex < Schema.Columns.Num(); ++ColumnIndex)
+	{
+		const FStructSchema::FColumn& Column = Schema.Columns[ColumnIndex];
+		const FString* PropertyValue = OutColumnValues[ColumnIndex];
+		if (!PropertyValue)
+		{
+			if (!Column.bImportOptional && !DataTable->bIgnoreMissingFields)
+			{
+				ImportProblems.Add(FString::Printf(TEXT("Row '%s' is missing an entry for '%s'."), *RowName.ToString(),
+					*Column.ExportName));
+			}
+
+			continue;
+		}
+
+		if (Column.Property->ArrayDim != 1)
+		{
+			ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' is the incorrect type. Expected Array, got String."),
+				*Column.ExportName, *RowName.ToString()));
+			bReadRow = false;
+			break;
+		}
+
+		void* Data = Column.Property->ContainerPtrToValuePtr<void>(RowData, 0);
+		ReadStringEntry(*PropertyValue, RowName, Column.ExportName, RowData, Column.Property, Data);
+	}
+
+	EndRow(RowName, RowData);
+
+	return bReadRow;
+}
+
+bool FGridlyDataTableImporterJSON::ReadStringEntry(const FString& InPropertyValue, const FName InRowName,
+	const FString& InColumnName, void* InRowData, FProperty* InProperty, void* InPropertyData)
+{
+	FNumericProperty* NumProp = CastField<FNumericProperty>(InProperty);
+	if (NumProp && !NumProp->IsEnum())
+	{
+		// Gridly cells are always strings, so numbers are parsed here rather than by the JSON reader
+		if (!InPropertyValue.IsNumeric())
+		{
+			ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' is the incorrect type. Expected %s, got String."),
+				*InColumnName, *InRowName.ToString(), NumProp->IsInteger() ? TEXT("Integer") : TEXT("Double")));
+			return false;
+		}
+
+		if (NumProp->IsInteger())
+		{
+			NumProp->SetIntPropertyValue(InPropertyData, FCString::Atoi64(*InPropertyValue));
+		}
+		else
+		{
+			NumProp->SetFloatingPointPropertyValue(InPropertyData, FCString::Atod(*InPropertyValue));
+		}
+	}
+	else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(InProperty))
+	{
+		BoolProp->SetPropertyValue(InPropertyData, InPropertyValue.ToBool());
+	}
+	else if (InProperty->IsA<FArrayProperty>() || InProperty->IsA<FSetProperty>() || InProperty->IsA<FMapProperty>())
+	{
+		// A cell is never a container, the same as when the records went through JSON text
+		ImportProblems.Add(FString::Printf(TEXT("Property '%s' on row '%s' is the incorrect type. Expected %s, got String."),
+			*InColumnName, *InRowName.ToString(), InProperty->IsA<FMapProperty>() ? TEXT("Object") : TEXT("Array")));
+		return false;
+	}
+	else
+	{
+		// Enums, strings, names, texts and structs use the same text import the JSON path falls back to
+		const FString Error = DataTableUtils::AssignStringToProperty(InPropertyValue, InProperty, (uint8*) InRowData);
+		if (Error.Len() > 0)
+		{
+			ImportProblems.Add(FString::Printf(TEXT("Problem assigning string '%s' to property '%s' on row '%s' : %s"),
+				*InPropertyValue, *InColumnName, *InRowName.ToString(), *Error));
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool FGridlyDataTableImporterJSON::ReadStructEntry(const TSharedRef<FJsonValue>& InParsedPropertyValue, const FName InRowName,
 	const FString& InColumnName, const void* InRowData, FProperty* InProperty, void* InPropertyData)
 {
@@ -12,16 +12,52 @@ namespace GridlyDataTableJSONUtils
 	FString GRIDLY_API GetKeyFieldName(const UDataTable& InDataTable);
 }
 
+struct FGridlyTableRow;
+class FGridlyTableRowSegment;
+
+/** Rows an import touched when it was applied as a diff */
+struct GRIDLY_API FGridlyDataTableImportChanges
+{
+	TArray<FName> AddedRows;
+	TArray<FName> RemovedRows;
+
+	/** Changed rows, with the export names of the columns that changed */
+	TMap<FName, TArray<FString>> ChangedRows;
+
+	bool HasChanges() const { return AddedRows.Num() > 0 || RemovedRows.Num() > 0 || ChangedRows.Num() > 0; }
+};
+
 class GRIDLY_API FGridlyDataTableImporterJSON
 {
 public:
 	FGridlyDataTableImporterJSON(UDataTable& InDataTable, const FString& InJSONData, TArray<FString>& OutProblems);
+
+	/** Imports already downloaded Gridly records directly, without going through JSON text */
+	FGridlyDataTableImporterJSON(UDataTable& InDataTable, const TArray<FGridlyTableRow>& InTableRows, TArray<FString>& OutProblems);
+
+	/** Imports downloaded Gridly records a page at a time, so records moved to a segment file are never all in memory */
+	FGridlyDataTableImporterJSON(UDataTable& InDataTable, const FGridlyTableRowSegment& InTableRowSegment, TArray<FString>& OutProblems);
 	~FGridlyDataTableImporterJSON();
 
 	bool ReadTable();
 
+	/**
+	 * Updates only rows and properties that differ from the table's current content, and removes rows that vanished.
+	 * The differences are collected first, InOnBeforeApply is called with them right before the table is touched.
+	 * Neither happens when nothing changed.
+	 */
+	bool ReadTableAsDiff(FGridlyDataTableImportChanges& OutChanges,
+		const TFunction<void(const FGridlyDataTableImportChanges&)>& InOnBeforeApply = nullptr);
+
 private:
+	bool ReadJSONRows();
+	bool ReadTableRows();
 	bool ReadRow(const TSharedRef<FJsonObject>& InParsedTableRowObject, const int32 InRowIdx);
+	bool IsDuplicateRow(const FName InRowName) const;
+	uint8* BeginRow(const FName InRowName);
+	void EndRow(const FName InRowName, uint8* InRowData);
+	void EndImport();
+	void ApplyDiff();
 	bool ReadStruct(const TSharedRef<FJsonObject>& InParsedObject, UScriptStruct* InStruct, const FName InRowName,
 		void* InStructData);
 	bool ReadStructEntry(const TSharedRef<FJsonValue>& InParsedPropertyValue, const FName InRowName, const FString& InColumnName,
@@ -29,8 +65,49 @@ private:
 	bool ReadContainerEntry(const TSharedRef<FJsonValue>& InParsedPropertyValue, const FName InRowName, const FString& InColumnName,
 		const int32 InArrayEntryIndex, FProperty* InProperty, void* InPropertyData);
 
+	bool ReadTableRow(const FGridlyTableRow& InTableRow, const int32 InRowIdx, TArray<const FString*>& OutColumnValues);
+	bool ReadStringEntry(const FString& InPropertyValue, const FName InRowName, const FString& InColumnName, void* InRowData,
+		FProperty* InProperty, void* InPropertyData);
+
+	/** Columns of a struct, resolved once per import instead of once per row */
+	struct FStructSchema
+	{
+		struct FColumn
+		{
+			FProperty* Property = nullptr;
+			FString ExportName;
+			TArray<FString> ImportNames;
+			bool bImportOptional = false;
+		};
+
+		TArray<FColumn> Columns;
+
+		/** Property name and every import name, mapped to the property they resolve to */
+		TMap<FString, FProperty*> PropertiesByColumnName;
+	};
+
+	const FStructSchema& GetStructSchema(const UScriptStruct* InStruct);
+	int32 FindRowStructColumnIndex(const FString& InColumnName);
+
+	TMap<const UScriptStruct*, TUniquePtr<FStructSchema>> StructSchemas;
+	FString RowKey;
+
+	/** Gridly column ID to row struct column index, INDEX_NONE for columns the struct does not have */
+	TMap<FString, int32> RowStructColumnIndices;
+
+	/** Set while an import is applied as a diff */
+	FGridlyDataTableImportChanges* DiffChanges = nullptr;
+	const TFunction<void(const FGridlyDataTableImportChanges&)>* OnBeforeApplyDiff = nullptr;
+	TSet<FName> ImportedRowNames;
+	uint8* DiffScratchRow = nullptr;
+
+	/** Copies of added and changed rows, held until the diff is applied */
+	TMap<FName, uint8*> PendingDiffRows;
+
 	UDataTable* DataTable;
-	const FString& JSONData;
+	const FString* JSONData;
+	const TArray<FGridlyTableRow>* TableRows;
+	const FGridlyTableRowSegment* TableRowSegment;
 	TArray<FString>& ImportProblems;
 };
 
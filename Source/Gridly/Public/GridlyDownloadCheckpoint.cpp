@@ -0,0 +1,184 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyDownloadCheckpoint.h"
+
+#include "Gridly.h"
+#include "GridlyApi.h"
+#include "GridlyGameSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace GridlyDownloadCheckpoint
+{
+	static const TCHAR* ManifestFileName = TEXT("Manifest.txt");
+	static const TCHAR* Version = TEXT("1");
+
+	/** Checkpoint directories held by downloads in progress */
+	static TSet<FString> OpenDirectories;
+}
+
+void FGridlyDownloadCheckpoint::Open(const FString& Name, const FString& Signature)
+{
+	Release();
+	RunId.Reset();
+	Pages.Reset();
+
+	if (!GetDefault<UGridlyGameSettings>()->bCheckpointDownloads)
+	{
+		return;
+	}
+
+	const FString NewDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Gridly"), TEXT("Checkpoints"), Name);
+	if (GridlyDownloadCheckpoint::OpenDirectories.Contains(NewDirectory))
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Checkpoint %s is held by another download, pages will not be checkpointed"), *Name);
+		return;
+	}
+
+	Directory = NewDirectory;
+	GridlyDownloadCheckpoint::OpenDirectories.Add(Directory);
+	SignatureHash = FString::Printf(TEXT("%08x"), FCrc::StrCrc32(*(FGridlyApi::GetBaseUrl() + TEXT("|") + Signature)));
+
+	// The manifest has a header line, then one line per page, appended once the page itself is on disk
+
+	TArray<FString> Lines;
+	FFileHelper::LoadFileToStringArray(Lines, *GetManifestPath());
+
+	TArray<FString> Header;
+	if (Lines.Num() > 0)
+	{
+		Lines[0].ParseIntoArray(Header, TEXT("\t"), false);
+	}
+
+	if (Header.Num() != 3 || Header[0] != GridlyDownloadCheckpoint::Version || Header[1] != SignatureHash)
+	{
+		StartRun();
+		return;
+	}
+
+	RunId = Header[2];
+	for (int32 i = 1; i < Lines.Num(); i++)
+	{
+		TArray<FString> Fields;
+		Lines[i].ParseIntoArray(Fields, TEXT("\t"), false);
+
+		// A line cut short by a crash ends the checkpoint
+		if (Fields.Num() != 6)
+		{
+			break;
+		}
+
+		FPage& Page = Pages.AddDefaulted_GetRef();
+		Page.ViewIndex = FCString::Atoi(*Fields[0]);
+		Page.ViewId = Fields[1];
+		Page.Offset = FCString::Atoi(*Fields[2]);
+		Page.Limit = FCString::Atoi(*Fields[3]);
+		Page.TotalCount = FCString::Atoi(*Fields[4]);
+		Page.FileName = Fields[5];
+	}
+
+	UE_LOG(LogGridly, Log, TEXT("Found %d checkpointed pages of %s run %s"), Pages.Num(), *Name, *RunId);
+}
+
+bool FGridlyDownloadCheckpoint::LoadPage(const FPage& Page, FString& OutContent) const
+{
+	return IsEnabled() && FFileHelper::LoadFileToString(OutContent, *FPaths::Combine(Directory, Page.FileName));
+}
+
+void FGridlyDownloadCheckpoint::AddPage(int32 ViewIndex, const FString& ViewId, int32 Offset, int32 Limit, int32 TotalCount,
+	const FString& Content)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FPage Page;
+	Page.ViewIndex = ViewIndex;
+	Page.ViewId = ViewId;
+	Page.Offset = Offset;
+	Page.Limit = Limit;
+	Page.TotalCount = TotalCount;
+	Page.FileName = FString::Printf(TEXT("%s_%s_%d.json"), *RunId, *ViewId, Offset);
+
+	const FString Line = FString::Printf(TEXT("%d\t%s\t%d\t%d\t%d\t%s\n"), ViewIndex, *ViewId, Offset, Limit, TotalCount,
+		*Page.FileName);
+
+	const FFileHelper::EEncodingOptions Encoding = FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM;
+	if (!FFileHelper::SaveStringToFile(Content, *FPaths::Combine(Directory, Page.FileName), Encoding)
+		|| !FFileHelper::SaveStringToFile(Line, *GetManifestPath(), Encoding, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Failed to checkpoint page at offset %d of view %s in: %s"), Offset, *ViewId, *Directory);
+		return;
+	}
+
+	Pages.Add(MoveTemp(Page));
+}
+
+bool FGridlyDownloadCheckpoint::IsConsistent(const FString& ViewId, int32 TotalCount) const
+{
+	for (int32 i = Pages.Num() - 1; i >= 0; i--)
+	{
+		if (Pages[i].ViewId == ViewId)
+		{
+			return Pages[i].TotalCount == TotalCount;
+		}
+	}
+
+	return true;
+}
+
+FGridlyDownloadCheckpoint::~FGridlyDownloadCheckpoint()
+{
+	Release();
+}
+
+void FGridlyDownloadCheckpoint::Discard()
+{
+	if (IsEnabled())
+	{
+		StartRun();
+	}
+}
+
+void FGridlyDownloadCheckpoint::Complete()
+{
+	if (IsEnabled())
+	{
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		UE_LOG(LogGridly, Verbose, TEXT("Deleted checkpoint of completed run %s"), *RunId);
+	}
+
+	Release();
+	RunId.Reset();
+	Pages.Reset();
+}
+
+void FGridlyDownloadCheckpoint::StartRun()
+{
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	Pages.Reset();
+	RunId = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+
+	const FString Header = FString::Printf(TEXT("%s\t%s\t%s\n"), GridlyDownloadCheckpoint::Version, *SignatureHash, *RunId);
+	if (!FFileHelper::SaveStringToFile(Header, *GetManifestPath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Failed to create download checkpoint, pages will not be checkpointed: %s"), *Directory);
+		Release();
+	}
+}
+
+void FGridlyDownloadCheckpoint::Release()
+{
+	if (!Directory.IsEmpty())
+	{
+		GridlyDownloadCheckpoint::OpenDirectories.Remove(Directory);
+		Directory.Reset();
+	}
+}
+
+FString FGridlyDownloadCheckpoint::GetManifestPath() const
+{
+	return FPaths::Combine(Directory, GridlyDownloadCheckpoint::ManifestFileName);
+}
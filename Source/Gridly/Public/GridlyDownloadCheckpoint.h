@@ -0,0 +1,66 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Spills the pages of a paginated download to Saved/Gridly/Checkpoints as they arrive, with the bCheckpointDownloads
+ * setting on. A download that failed or was restarted replays the finished pages and resumes after the last one,
+ * instead of starting over from offset 0. The checkpoint is deleted once the download completes. Only one download at
+ * a time can hold a checkpoint name, another one that opens it runs without a checkpoint.
+ */
+class GRIDLY_API FGridlyDownloadCheckpoint
+{
+public:
+	struct FPage
+	{
+		int32 ViewIndex = 0;
+		FString ViewId;
+		int32 Offset = 0;
+		int32 Limit = 0;
+
+		/** X-Total-Count of the view when the page was downloaded */
+		int32 TotalCount = 0;
+
+		FString FileName;
+	};
+
+	/**
+	 * Starts or resumes the download called Name. Pages are only resumed from a run against the same API endpoint and
+	 * with the same Signature, which should cover everything that shapes the pages, such as view and column IDs.
+	 */
+	void Open(const FString& Name, const FString& Signature);
+
+	~FGridlyDownloadCheckpoint();
+
+	bool IsEnabled() const { return !Directory.IsEmpty(); }
+	const FString& GetRunId() const { return RunId; }
+
+	/** Pages checkpointed by earlier attempts of this run, in download order */
+	const TArray<FPage>& GetPages() const { return Pages; }
+	bool LoadPage(const FPage& Page, FString& OutContent) const;
+
+	void AddPage(int32 ViewIndex, const FString& ViewId, int32 Offset, int32 Limit, int32 TotalCount, const FString& Content);
+
+	/** Whether a view still reports the total count it had when its last page was checkpointed */
+	bool IsConsistent(const FString& ViewId, int32 TotalCount) const;
+
+	/** Deletes the pages and starts a new run, for when they no longer match the view */
+	void Discard();
+
+	/** Deletes the checkpoint once the download has finished */
+	void Complete();
+
+private:
+	void StartRun();
+
+	/** Gives up the checkpoint directory so that another download can open it */
+	void Release();
+	FString GetManifestPath() const;
+
+	FString Directory;
+	FString SignatureHash;
+	FString RunId;
+	TArray<FPage> Pages;
+};
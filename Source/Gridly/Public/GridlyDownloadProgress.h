@@ -0,0 +1,23 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Counters passed to native progress delegates along with the records of the page that just arrived */
+struct FGridlyDownloadProgress
+{
+	/** Records downloaded so far, including this page */
+	int32 NumRecords = 0;
+
+	int32 NumPageRecords = 0;
+
+	/** Records reported by X-Total-Count, summed over the views started so far */
+	int32 TotalCount = 0;
+
+	int32 ViewIndex = 0;
+	int32 NumViews = 0;
+
+	/** Estimated fraction of the download done, as passed to OnProgress */
+	float Progress = 0.f;
+};
@@ -113,6 +113,44 @@ public:
     UPROPERTY(Category = "Gridly|Options", BlueprintReadOnly, EditAnywhere, Config, meta = (EditCondition = "bExportMetadata"))
     TMap<FString, FGridlyColumnInfo> MetadataMapping;
 
+    /** Base URL of the Gridly API. Leave empty to use https://api.gridly.com, or set it to an on-premise mirror or a local stand-in. -GridlyApiUrl= on the command line takes precedence */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config)
+    FString ApiBaseUrl;
+
+    /** When set, the records per request adapt to the size and response time of earlier requests, within the max records per request settings */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config)
+    bool bAdaptiveBatchSizes = false;
+
+    /** Request or response body size that adaptive batch sizes aim for */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config,
+        meta = (EditCondition = "bAdaptiveBatchSizes", ClampMin = "16", Units = "KiloBytes"))
+    int TargetRequestSizeKB = 1024;
+
+    /** Response time that adaptive batch sizes aim for */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config,
+        meta = (EditCondition = "bAdaptiveBatchSizes", ClampMin = "0.5", Units = "Seconds"))
+    float TargetRequestSeconds = 5.f;
+
+    /** When set, text imports and source change downloads only request the namespace and language columns they read, instead of every column of the view. Leave unset if language column IDs on Gridly do not follow the culture mapping exactly */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config)
+    bool bDownloadOnlyTextColumns = false;
+
+    /** When set, export and delete request bodies are sent gzip compressed and downloads ask for compressed responses. Only enable this if the API endpoint accepts gzip encoded request bodies */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config)
+    bool bCompressTransfers = false;
+
+    /** When set, text imports and source change downloads save each page under Saved/Gridly/Checkpoints as it arrives, so a failed or restarted download resumes after the last saved page */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config)
+    bool bCheckpointDownloads = false;
+
+    /** Memory that data table imports and source change downloads may fill with downloaded records before moving them to files under Saved/Gridly. Blueprint delegates then only receive the records still in memory. Zero keeps every record in memory */
+    UPROPERTY(Category = "Gridly|Options|Advanced", BlueprintReadOnly, EditAnywhere, Config, meta = (ClampMin = "0", Units = "MegaBytes"))
+    int DownloadMemoryBudgetMB = 0;
+
+    /** When set, packaged builds register the texts cached from the last Gridly download on startup, then refresh them from Gridly in the background */
+    UPROPERTY(Category = "Gridly|Runtime Settings", BlueprintReadOnly, EditAnywhere, Config)
+    bool bEnableOverTheAirUpdates = false;
+
 public:
     UGridlyGameSettings(const FObjectInitializer& ObjectInitializer);
 
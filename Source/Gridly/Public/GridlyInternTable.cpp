@@ -0,0 +1,30 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyInternTable.h"
+
+int32 FGridlyInternTable::Intern(const FString& String)
+{
+	if (const int32* Handle = Handles.Find(String))
+	{
+		return *Handle;
+	}
+
+	const int32 Handle = Strings.Add(String);
+	Handles.Add(String, Handle);
+	CaseInsensitiveHandles.Add(CaseInsensitiveHandleLookup.FindOrAdd(String, Handle));
+	return Handle;
+}
+
+int32 FGridlyInternTable::Find(const FString& String) const
+{
+	const int32* Handle = Handles.Find(String);
+	return Handle ? *Handle : INDEX_NONE;
+}
+
+void FGridlyInternTable::Reset()
+{
+	Strings.Reset();
+	CaseInsensitiveHandles.Reset();
+	Handles.Reset();
+	CaseInsensitiveHandleLookup.Reset();
+}
@@ -0,0 +1,42 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-session string pool for values that repeat across many records, such as namespaces, column IDs and cultures.
+ * Each distinct string is stored once and referred to by a small integer handle, so records can hold and compare
+ * handles instead of their own FString copies.
+ */
+class GRIDLY_API FGridlyInternTable
+{
+public:
+	/** Returns the handle of String, adding it on first use. Handles are case sensitive */
+	int32 Intern(const FString& String);
+
+	/** Returns the handle of String, or INDEX_NONE if it was never interned */
+	int32 Find(const FString& String) const;
+
+	const FString& Resolve(int32 Handle) const { return Strings[Handle]; }
+
+	/** Returns the handle of the first interned string that matches Handle's ignoring case, like FString map keys do */
+	int32 GetCaseInsensitiveHandle(int32 Handle) const { return CaseInsensitiveHandles[Handle]; }
+
+	int32 Num() const { return Strings.Num(); }
+	const TArray<FString>& GetStrings() const { return Strings; }
+
+	void Reset();
+
+private:
+	struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	TArray<FString> Strings;
+	TArray<int32> CaseInsensitiveHandles;
+	TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Handles;
+	TMap<FString, int32> CaseInsensitiveHandleLookup;
+};
@@ -0,0 +1,160 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyLocalizationCache.h"
+
+#include "Gridly.h"
+#include "GridlyTask_DownloadLocalizedTexts.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Internationalization/PolyglotTextData.h"
+#include "Internationalization/TextLocalizationManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GridlyLocalizationCache
+{
+	static const uint32 Magic = 0x434C5247; // "GRLC"
+	static const int32 Version = 1;
+}
+
+FString FGridlyLocalizationCache::GetCachePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Gridly"), TEXT("LocalizationCache.bin"));
+}
+
+bool FGridlyLocalizationCache::Save(const TArray<FPolyglotTextData>& PolyglotTextDatas)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = GridlyLocalizationCache::Magic;
+	int32 Version = GridlyLocalizationCache::Version;
+	int32 NumTexts = PolyglotTextDatas.Num();
+	Writer << Magic << Version << NumTexts;
+
+	for (const FPolyglotTextData& PolyglotTextData : PolyglotTextDatas)
+	{
+		uint8 Category = static_cast<uint8>(PolyglotTextData.GetCategory());
+		FString Namespace = PolyglotTextData.GetNamespace();
+		FString Key = PolyglotTextData.GetKey();
+		FString NativeCulture = PolyglotTextData.GetNativeCulture();
+		FString NativeString = PolyglotTextData.GetNativeString();
+		Writer << Category << Namespace << Key << NativeCulture << NativeString;
+
+		TArray<FString> LocalizedCultures = PolyglotTextData.GetLocalizedCultures();
+		int32 NumLocalizedStrings = LocalizedCultures.Num();
+		Writer << NumLocalizedStrings;
+		for (FString& Culture : LocalizedCultures)
+		{
+			FString LocalizedString;
+			PolyglotTextData.GetLocalizedString(Culture, LocalizedString);
+			Writer << Culture << LocalizedString;
+		}
+	}
+
+	// Write next to the cache and swap, so a crash mid-write never leaves a truncated cache behind
+	const FString CachePath = GetCachePath();
+	const FString TempPath = CachePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*CachePath, *TempPath))
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Failed to write localization cache: %s"), *CachePath);
+		return false;
+	}
+
+	UE_LOG(LogGridly, Log, TEXT("Saved %d texts to localization cache: %s"), NumTexts, *CachePath);
+	return true;
+}
+
+bool FGridlyLocalizationCache::Load(TArray<FPolyglotTextData>& OutPolyglotTextDatas)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetCachePath(), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumTexts = 0;
+	Reader << Magic << Version << NumTexts;
+	if (Reader.IsError() || Magic != GridlyLocalizationCache::Magic || Version != GridlyLocalizationCache::Version || NumTexts < 0)
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Ignoring localization cache with unknown format: %s"), *GetCachePath());
+		return false;
+	}
+
+	OutPolyglotTextDatas.Reset(NumTexts);
+	for (int32 i = 0; i < NumTexts && !Reader.IsError(); i++)
+	{
+		uint8 Category = 0;
+		FString Namespace;
+		FString Key;
+		FString NativeCulture;
+		FString NativeString;
+		Reader << Category << Namespace << Key << NativeCulture << NativeString;
+
+		FPolyglotTextData PolyglotTextData(static_cast<ELocalizedTextSourceCategory>(Category), Namespace, Key, NativeString,
+			NativeCulture);
+
+		int32 NumLocalizedStrings = 0;
+		Reader << NumLocalizedStrings;
+		for (int32 j = 0; j < NumLocalizedStrings && !Reader.IsError(); j++)
+		{
+			FString Culture;
+			FString LocalizedString;
+			Reader << Culture << LocalizedString;
+			PolyglotTextData.AddLocalizedString(Culture, LocalizedString);
+		}
+
+		OutPolyglotTextDatas.Add(MoveTemp(PolyglotTextData));
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Ignoring truncated localization cache: %s"), *GetCachePath());
+		OutPolyglotTextDatas.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FGridlyLocalizationCache::RegisterCachedTexts()
+{
+	TArray<FPolyglotTextData> PolyglotTextDatas;
+	if (!Load(PolyglotTextDatas))
+	{
+		return false;
+	}
+
+	FTextLocalizationManager::Get().RegisterPolyglotTextData(PolyglotTextDatas);
+	UE_LOG(LogGridly, Log, TEXT("Registered %d texts from localization cache"), PolyglotTextDatas.Num());
+	return true;
+}
+
+void FGridlyLocalizationCache::StartBackgroundRefresh()
+{
+	UGridlyTask_DownloadLocalizedTexts* Task = UGridlyTask_DownloadLocalizedTexts::DownloadLocalizedTexts(nullptr);
+
+	Task->OnSuccessDelegate.BindLambda([](const TArray<FPolyglotTextData>& PolyglotTextDatas)
+	{
+		FTextLocalizationManager::Get().RegisterPolyglotTextData(PolyglotTextDatas);
+		UE_LOG(LogGridly, Log, TEXT("Refreshed %d texts from Gridly"), PolyglotTextDatas.Num());
+
+		Async(EAsyncExecution::ThreadPool, [PolyglotTextDatas]()
+		{
+			Save(PolyglotTextDatas);
+		});
+	});
+
+	Task->OnFailDelegate.BindLambda([](const TArray<FPolyglotTextData>& PolyglotTextDatas, const FGridlyResult& Error)
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Failed to refresh texts from Gridly, keeping cached texts: %s"), *Error.Message);
+	});
+
+	Task->Activate();
+}
@@ -0,0 +1,26 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPolyglotTextData;
+
+/**
+ * Binary cache of the last texts downloaded from Gridly, so packaged builds can register them on startup
+ * before any network access and refresh them in the background
+ */
+class GRIDLY_API FGridlyLocalizationCache
+{
+public:
+	static FString GetCachePath();
+
+	static bool Save(const TArray<FPolyglotTextData>& PolyglotTextDatas);
+	static bool Load(TArray<FPolyglotTextData>& OutPolyglotTextDatas);
+
+	/** Registers the cached texts with the text localization manager, if a cache exists */
+	static bool RegisterCachedTexts();
+
+	/** Downloads the current texts from Gridly without blocking, then registers and caches them */
+	static void StartBackgroundRefresh();
+};
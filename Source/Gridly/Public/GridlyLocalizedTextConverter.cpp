@@ -3,171 +3,256 @@
 #include "GridlyLocalizedTextConverter.h"
 
 #include "Gridly.h"
+#include "GridlyCancellationToken.h"
 #include "GridlyCultureConverter.h"
 #include "GridlyDataTableImporterJSON.h"
 #include "GridlyGameSettings.h"
+#include "GridlyStats.h"
+#include "GridlyTextRecordStore.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "Internationalization/PolyglotTextData.h"
-#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 
 bool FGridlyLocalizedTextConverter::TableRowsToPolyglotTextDatas(const TArray<FGridlyTableRow>& TableRows,
 	TMap<FString, FPolyglotTextData>& OutPolyglotTextDatas)
 {
-	UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
-	const TArray<FString> TargetCultures = FGridlyCultureConverter::GetTargetCultures();
+	FGridlyTextRecordStore TextRecords;
+	TextRecords.Reset(FGridlyCultureConverter::GetTargetCultures());
+	TextRecords.AppendTableRows(TableRows);
 
-	const bool bUseCombinedNamespaceKey = GameSettings->bUseCombinedNamespaceId;
-	const bool bUsePathAsNamespace = !bUseCombinedNamespaceKey && GameSettings->NamespaceColumnId == "path";
+	for (int32 i = 0; i < TextRecords.Num(); i++)
+	{
+		OutPolyglotTextDatas.Add(FString(TextRecords.GetRecordId(i)), TextRecords.ToPolyglotTextData(i));
+	}
+
+	return OutPolyglotTextDatas.Num() > 0;
+}
 
-	for (int i = 0; i < TableRows.Num(); i++)
+namespace GridlyPoFile
+{
+	/**
+	 * Streams .po entries to disk as UTF-8. Strings are escaped while they are converted into one reusable buffer,
+	 * which is written through the file handle in large blocks and hashed on the way out.
+	 */
+	class FWriter
 	{
-		UE_LOG(LogGridly, Verbose, TEXT("Row %d: %s (%s)"), i, *TableRows[i].Id, *TableRows[i].Path);
+	public:
+		explicit FWriter(const FString& Path)
+		{
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+			FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path));
+			Buffer.Reserve(BufferSize);
+		}
 
-		FString Key = TableRows[i].Id;
-		FString FullKey = Key;
-		FString Namespace = bUsePathAsNamespace ? TableRows[i].Path : TEXT("");
-		FString SourceCulture;
-		FString SourceText;
-		TMap<FString, FString> Translations;
+		bool IsOpen() const { return FileHandle.IsValid(); }
 
-		for (int j = 0; j < TableRows[i].Cells.Num(); j++)
+		void WriteEntry(FStringView Namespace, FStringView Key, FStringView NativeString, FStringView TargetString)
 		{
-			const FGridlyTableCell& GridlyTableCell = TableRows[i].Cells[j];
+			WriteAnsi("msgctxt \"");
+			WriteUnescaped(Namespace);
+			WriteAnsi(",");
+			WriteUnescaped(Key);
+			WriteAnsi("\"" LINE_TERMINATOR_ANSI "msgid \"");
+			WriteEscaped(NativeString);
+			WriteAnsi("\"" LINE_TERMINATOR_ANSI "msgstr \"");
+			WriteEscaped(TargetString);
+			WriteAnsi("\"" LINE_TERMINATOR_ANSI LINE_TERMINATOR_ANSI);
+		}
 
-			// If special columns
+		/** Flushes what is left and closes the file, returning false if any write failed */
+		bool Close()
+		{
+			Flush();
+			FileHandle.Reset();
+			return !bWriteFailed;
+		}
 
-			if (!bUsePathAsNamespace && GridlyTableCell.ColumnId == GameSettings->NamespaceColumnId)
-			{
-				Namespace = GridlyTableCell.Value;
-				continue;
-			}
+		/** MD5 of everything written, valid after Close */
+		FString GetContentHash()
+		{
+			uint8 Digest[16];
+			Md5.Final(Digest);
+			return BytesToHex(Digest, UE_ARRAY_COUNT(Digest));
+		}
 
-			// If language column
+	private:
+		static constexpr int32 BufferSize = 256 * 1024;
 
-			if (GridlyTableCell.ColumnId.StartsWith(GameSettings->SourceLanguageColumnIdPrefix))
+		// Same escapes as ConditionArchiveStrForPO in the engine's PortableObjectPipeline.cpp
+		static const ANSICHAR* GetEscapeSequence(TCHAR Char)
+		{
+			switch (Char)
 			{
-				const FString GridlyCulture = GridlyTableCell.ColumnId.RightChop(GameSettings->SourceLanguageColumnIdPrefix.Len());
-				FString Culture;
-				if (FGridlyCultureConverter::ConvertFromGridly(TargetCultures, GridlyCulture, Culture))
-				{
-					SourceCulture = Culture;
-					SourceText = GridlyTableCell.Value;
-				}
+			case TEXT('\\'): return "\\\\";
+			case TEXT('"'): return "\\\"";
+			case TEXT('\r'): return "\\r";
+			case TEXT('\n'): return "\\n";
+			case TEXT('\t'): return "\\t";
+			default: return nullptr;
 			}
-			else if (GridlyTableCell.ColumnId.StartsWith(GameSettings->TargetLanguageColumnIdPrefix))
+		}
+
+		void WriteAnsi(const ANSICHAR* String)
+		{
+			Buffer.Append(reinterpret_cast<const uint8*>(String), FCStringAnsi::Strlen(String));
+			FlushIfFull();
+		}
+
+		void WriteUnescaped(FStringView String)
+		{
+			Convert(String.GetData(), String.Len());
+			FlushIfFull();
+		}
+
+		void WriteEscaped(FStringView String)
+		{
+			const TCHAR* Run = String.GetData();
+			const TCHAR* End = Run + String.Len();
+			for (const TCHAR* It = Run; It != End; ++It)
 			{
-				const FString GridlyCulture = GridlyTableCell.ColumnId.RightChop(GameSettings->TargetLanguageColumnIdPrefix.Len());
-				FString Culture;
-				if (FGridlyCultureConverter::ConvertFromGridly(TargetCultures, GridlyCulture, Culture))
+				if (const ANSICHAR* EscapeSequence = GetEscapeSequence(*It))
 				{
-					Translations.Add(Culture, GridlyTableCell.Value);
+					Convert(Run, It - Run);
+					Buffer.Append(reinterpret_cast<const uint8*>(EscapeSequence), FCStringAnsi::Strlen(EscapeSequence));
+					Run = It + 1;
 				}
 			}
+			Convert(Run, End - Run);
+			FlushIfFull();
 		}
 
-		// Namespace / key fixes
-
-		if (bUseCombinedNamespaceKey)
+		void Convert(const TCHAR* Chars, int32 Len)
 		{
-			FString NewKey;
-			if (Key.Split(",", &Namespace, &NewKey))
+			if (Len <= 0)
 			{
-				Key = NewKey;
+				return;
 			}
-		}
 
-		Namespace = Namespace.Replace(TEXT(" "), TEXT(""));
+			const int32 ConvertedLen = FPlatformString::ConvertedLength<UTF8CHAR>(Chars, Len);
+			const int32 Offset = Buffer.AddUninitialized(ConvertedLen);
+			FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Buffer.GetData() + Offset), ConvertedLen, Chars, Len);
+		}
 
-		if (SourceText.IsEmpty() || SourceCulture.IsEmpty())
+		void FlushIfFull()
 		{
-			UE_LOG(LogGridly, Warning, TEXT("Could not find native culture/source string in imported text with key: %s,%s"),
-				*Namespace, *Key);
-			//continue;
+			if (Buffer.Num() >= BufferSize)
+			{
+				Flush();
+			}
 		}
 
-		FPolyglotTextData PolyglotTextData(ELocalizedTextSourceCategory::Game, Namespace, Key, SourceText, SourceCulture);
-
-		for (const TPair<FString, FString>& Pair : Translations)
+		void Flush()
 		{
-			if (!Pair.Value.IsEmpty())
+			if (Buffer.Num() > 0)
 			{
-				PolyglotTextData.AddLocalizedString(Pair.Key, Pair.Value);
+				Md5.Update(Buffer.GetData(), Buffer.Num());
+				if (FileHandle.IsValid() && !FileHandle->Write(Buffer.GetData(), Buffer.Num()))
+				{
+					bWriteFailed = true;
+				}
 			}
+			Buffer.Reset();
 		}
 
-		OutPolyglotTextDatas.Add(FullKey, PolyglotTextData);
-	}
+		TUniquePtr<IFileHandle> FileHandle;
+		TArray<uint8> Buffer;
+		FMD5 Md5;
+		bool bWriteFailed = false;
+	};
 
-	return OutPolyglotTextDatas.Num() > 0;
-}
+	bool Finish(FWriter& Writer, int32 NumEntries, const FString& Path)
+	{
+		if (Writer.Close())
+		{
+			UE_LOG(LogGridly, Log, TEXT("Exported .po file (%d lines): %s"), NumEntries * 4, *Path);
+			return NumEntries > 0;
+		}
 
-// Taken from "Engine\Source\Developer\Localization\Private\PortableObjectPipeline.cpp"
-FString ConditionArchiveStrForPO(const FString& InStr)
-{
-	FString Result = InStr;
-	Result.ReplaceInline(TEXT("\\"), TEXT("\\\\"), ESearchCase::CaseSensitive);
-	Result.ReplaceInline(TEXT("\""), TEXT("\\\""), ESearchCase::CaseSensitive);
-	Result.ReplaceInline(TEXT("\r"), TEXT("\\r"), ESearchCase::CaseSensitive);
-	Result.ReplaceInline(TEXT("\n"), TEXT("\\n"), ESearchCase::CaseSensitive);
-	Result.ReplaceInline(TEXT("\t"), TEXT("\\t"), ESearchCase::CaseSensitive);
-	return Result;
+		UE_LOG(LogGridly, Error, TEXT("Failed to export .po file to path: %s"), *Path);
+		return false;
+	}
 }
 
 bool FGridlyLocalizedTextConverter::WritePoFile(const TArray<FPolyglotTextData>& PolyglotTextDatas, const FString& TargetCulture,
 	const FString& Path)
 {
-	TArray<FString> Lines;
-	int numOfLines = 0;
-	TArray<TCHAR> CharsToReplace = { TEXT('\n'), TEXT('\r'), TEXT('\t'), TEXT('"'), TEXT('\\') };
+	GRIDLY_PERF_SCOPE(Import, FileWrite);
 
-	for (int i = 0; i < PolyglotTextDatas.Num(); i++)
+	GridlyPoFile::FWriter Writer(Path);
+	if (!Writer.IsOpen())
+	{
+		UE_LOG(LogGridly, Error, TEXT("Failed to export .po file to path: %s"), *Path);
+		return false;
+	}
+
+	for (const FPolyglotTextData& PolyglotTextData : PolyglotTextDatas)
 	{
 		FString TargetString;
+		PolyglotTextData.GetLocalizedString(TargetCulture, TargetString);
 
-		if (PolyglotTextDatas[i].GetLocalizedString(TargetCulture, TargetString))
-		{
-			Lines.Add(FString::Printf(TEXT("msgctxt \"%s,%s\""), *PolyglotTextDatas[i].GetNamespace(),
-				*PolyglotTextDatas[i].GetKey()));
+		Writer.WriteEntry(PolyglotTextData.GetNamespace(), PolyglotTextData.GetKey(), PolyglotTextData.GetNativeString(),
+			TargetString);
+	}
 
-			
-			FString NativeString = PolyglotTextDatas[i].GetNativeString().ReplaceCharWithEscapedChar(&CharsToReplace);
-			Lines.Add(FString::Printf(TEXT("msgid \"%s\""), *NativeString));
+	return GridlyPoFile::Finish(Writer, PolyglotTextDatas.Num(), Path);
+}
 
-			TargetString = ConditionArchiveStrForPO(TargetString);
-			//TargetString.ReplaceCharWithEscapedChar(&CharsToReplace);
-			Lines.Add(FString::Printf(TEXT("msgstr \"%s\""), *TargetString));
+bool FGridlyLocalizedTextConverter::WritePoFile(const FGridlyTextRecordStore& TextRecords, const FString& TargetCulture,
+	const FString& Path, FString* OutContentHash, const FGridlyCancellationToken* CancellationToken)
+{
+	GRIDLY_PERF_SCOPE(Import, FileWrite);
+
+	GridlyPoFile::FWriter Writer(Path);
+	if (!Writer.IsOpen())
+	{
+		UE_LOG(LogGridly, Error, TEXT("Failed to export .po file to path: %s"), *Path);
+		return false;
+	}
 
-			Lines.Add(TEXT(""));
-		}		
-		else {
-			Lines.Add(FString::Printf(TEXT("msgctxt \"%s,%s\""), *PolyglotTextDatas[i].GetNamespace(),
-				*PolyglotTextDatas[i].GetKey()));
+	const int32 CultureIndex = TextRecords.FindCulture(TargetCulture);
 
+	for (int32 i = 0; i < TextRecords.Num(); i++)
+	{
+		if (CancellationToken && CancellationToken->IsCancelled())
+		{
+			Writer.Close();
+			IFileManager::Get().Delete(*Path);
+			UE_LOG(LogGridly, Log, TEXT("Cancelled exporting .po file: %s"), *Path);
+			return false;
+		}
 
-			FString NativeString = PolyglotTextDatas[i].GetNativeString().ReplaceCharWithEscapedChar(&CharsToReplace);
-			Lines.Add(FString::Printf(TEXT("msgid \"%s\""), *NativeString));
+		FStringView LocalizedString;
+		TextRecords.GetLocalizedString(i, CultureIndex, LocalizedString);
 
-			TargetString = TEXT("");
-			TargetString = TargetString.ReplaceCharWithEscapedChar(&CharsToReplace);
-			Lines.Add(FString::Printf(TEXT("msgstr \"%s\""), *TargetString));
+		Writer.WriteEntry(TextRecords.GetNamespace(i), TextRecords.GetKey(i), TextRecords.GetNativeString(i), LocalizedString);
+	}
 
-			Lines.Add(TEXT(""));
-		}
-		
+	const bool bSuccess = GridlyPoFile::Finish(Writer, TextRecords.Num(), Path);
+	if (OutContentHash)
+	{
+		*OutContentHash = Writer.GetContentHash();
 	}
+	return bSuccess;
+}
 
-	if (FFileHelper::SaveStringArrayToFile(Lines, *Path))
+void FGridlyLocalizedTextConverter::WritePoFiles(const FGridlyTextRecordStore& TextRecords, const TArray<FString>& TargetCultures,
+	const TArray<FString>& Paths, TArray<bool>& OutResults, TArray<FString>* OutContentHashes,
+	const FGridlyCancellationToken* CancellationToken)
+{
+	check(TargetCultures.Num() == Paths.Num());
+
+	OutResults.Init(false, TargetCultures.Num());
+	if (OutContentHashes)
 	{
-		UE_LOG(LogGridly, Log, TEXT("Exported .po file (%d lines): %s"), Lines.Num(), *Path);
-		if (Lines.Num() > 0) {
-			return true;
-		}
-		else {
-			return false;
-		}
+		OutContentHashes->Init(FString(), TargetCultures.Num());
 	}
-	else
+
+	ParallelFor(TargetCultures.Num(), [&](int32 Index)
 	{
-		UE_LOG(LogGridly, Error, TEXT("Failed to export .po file to path: %s"), *Path);
-		return false;
-	}	
-}
\ No newline at end of file
+		OutResults[Index] = WritePoFile(TextRecords, TargetCultures[Index], Paths[Index],
+			OutContentHashes ? &(*OutContentHashes)[Index] : nullptr, CancellationToken);
+	});
+}
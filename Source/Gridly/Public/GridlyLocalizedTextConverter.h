@@ -6,10 +6,24 @@
 
 #include "GridlyTableRow.h"
 
+class FGridlyCancellationToken;
+class FGridlyTextRecordStore;
+
 class GRIDLY_API FGridlyLocalizedTextConverter
 {
 public:
 	static bool TableRowsToPolyglotTextDatas(const TArray<FGridlyTableRow>& TableRows,
 		TMap<FString, FPolyglotTextData>& OutPolyglotTextDatas);
 	static bool WritePoFile(const TArray<FPolyglotTextData>& PolyglotTextDatas, const FString& TargetCulture, const FString& Path);
+	/**
+	 * OutContentHash, if given, receives the MD5 of the written file so callers can tell whether a culture changed.
+	 * Once CancellationToken is cancelled the partly written file is deleted and false is returned.
+	 */
+	static bool WritePoFile(const FGridlyTextRecordStore& TextRecords, const FString& TargetCulture, const FString& Path,
+		FString* OutContentHash = nullptr, const FGridlyCancellationToken* CancellationToken = nullptr);
+
+	/** Writes one .po file per culture from the same records in parallel. OutResults holds the WritePoFile result of each culture */
+	static void WritePoFiles(const FGridlyTextRecordStore& TextRecords, const TArray<FString>& TargetCultures,
+		const TArray<FString>& Paths, TArray<bool>& OutResults, TArray<FString>* OutContentHashes = nullptr,
+		const FGridlyCancellationToken* CancellationToken = nullptr);
 };
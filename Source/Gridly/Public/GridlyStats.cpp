@@ -0,0 +1,177 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyStats.h"
+
+#include "Gridly.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("HTTP Requests"), STAT_GridlyHttpRequests, STATGROUP_Gridly);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bytes Sent"), STAT_GridlyBytesSent, STATGROUP_Gridly);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bytes Received"), STAT_GridlyBytesReceived, STATGROUP_Gridly);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Records"), STAT_GridlyRecords, STATGROUP_Gridly);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("HTTP Latency (ms)"), STAT_GridlyHttpLatency, STATGROUP_Gridly);
+
+TRACE_DECLARE_INT_COUNTER(GridlyHttpRequests, TEXT("Gridly/HTTP Requests"));
+TRACE_DECLARE_MEMORY_COUNTER(GridlyBytesSent, TEXT("Gridly/Bytes Sent"));
+TRACE_DECLARE_MEMORY_COUNTER(GridlyBytesReceived, TEXT("Gridly/Bytes Received"));
+TRACE_DECLARE_INT_COUNTER(GridlyRecords, TEXT("Gridly/Records"));
+
+namespace GridlyStats
+{
+	constexpr int32 NumOperations = static_cast<int32>(EGridlyPerfOperation::Num);
+	constexpr int32 NumPhases = static_cast<int32>(EGridlyPerfPhase::Num);
+
+	struct FOperationCounters
+	{
+		double PhaseSeconds[NumPhases] = {};
+		int32 PhaseCalls[NumPhases] = {};
+		int64 BytesSent = 0;
+		int64 BytesReceived = 0;
+		int64 Records = 0;
+	};
+
+	FCriticalSection CountersLock;
+	FOperationCounters Counters[NumOperations];
+
+	FOperationCounters& Get(EGridlyPerfOperation Operation)
+	{
+		return Counters[static_cast<int32>(Operation)];
+	}
+}
+
+void FGridlyPerfCounters::AddPhaseTime(EGridlyPerfOperation Operation, EGridlyPerfPhase Phase, double Seconds)
+{
+	FScopeLock Lock(&GridlyStats::CountersLock);
+	GridlyStats::FOperationCounters& OperationCounters = GridlyStats::Get(Operation);
+	OperationCounters.PhaseSeconds[static_cast<int32>(Phase)] += Seconds;
+	OperationCounters.PhaseCalls[static_cast<int32>(Phase)]++;
+}
+
+void FGridlyPerfCounters::AddHttpRequest(EGridlyPerfOperation Operation, double LatencySeconds, int64 BytesSent, int64 BytesReceived)
+{
+	AddPhaseTime(Operation, EGridlyPerfPhase::Http, LatencySeconds);
+
+	{
+		FScopeLock Lock(&GridlyStats::CountersLock);
+		GridlyStats::FOperationCounters& OperationCounters = GridlyStats::Get(Operation);
+		OperationCounters.BytesSent += BytesSent;
+		OperationCounters.BytesReceived += BytesReceived;
+	}
+
+	INC_DWORD_STAT(STAT_GridlyHttpRequests);
+	INC_DWORD_STAT_BY(STAT_GridlyBytesSent, BytesSent);
+	INC_DWORD_STAT_BY(STAT_GridlyBytesReceived, BytesReceived);
+	INC_FLOAT_STAT_BY(STAT_GridlyHttpLatency, LatencySeconds * 1000.0);
+
+	TRACE_COUNTER_INCREMENT(GridlyHttpRequests);
+	TRACE_COUNTER_ADD(GridlyBytesSent, BytesSent);
+	TRACE_COUNTER_ADD(GridlyBytesReceived, BytesReceived);
+
+	UE_LOG(LogGridly, Log, TEXT("%s request: %.1f ms, %lld bytes sent, %lld bytes received on the wire"), GetOperationName(Operation),
+		LatencySeconds * 1000.0, BytesSent, BytesReceived);
+}
+
+void FGridlyPerfCounters::AddRecords(EGridlyPerfOperation Operation, int64 NumRecords)
+{
+	{
+		FScopeLock Lock(&GridlyStats::CountersLock);
+		GridlyStats::Get(Operation).Records += NumRecords;
+	}
+
+	INC_DWORD_STAT_BY(STAT_GridlyRecords, NumRecords);
+	TRACE_COUNTER_ADD(GridlyRecords, NumRecords);
+}
+
+void FGridlyPerfCounters::Reset()
+{
+	FScopeLock Lock(&GridlyStats::CountersLock);
+	for (GridlyStats::FOperationCounters& OperationCounters : GridlyStats::Counters)
+	{
+		OperationCounters = GridlyStats::FOperationCounters();
+	}
+}
+
+void FGridlyPerfCounters::LogSummary()
+{
+	using namespace GridlyStats;
+
+	FOperationCounters Snapshot[NumOperations];
+	{
+		FScopeLock Lock(&CountersLock);
+		for (int32 OperationIndex = 0; OperationIndex < NumOperations; OperationIndex++)
+		{
+			Snapshot[OperationIndex] = Counters[OperationIndex];
+		}
+	}
+
+	UE_LOG(LogGridly, Display, TEXT("Gridly performance summary:"));
+
+	bool bAnyOperation = false;
+	for (int32 OperationIndex = 0; OperationIndex < NumOperations; OperationIndex++)
+	{
+		const FOperationCounters& OperationCounters = Snapshot[OperationIndex];
+
+		double TotalSeconds = 0.0;
+		int32 TotalCalls = 0;
+		for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; PhaseIndex++)
+		{
+			TotalSeconds += OperationCounters.PhaseSeconds[PhaseIndex];
+			TotalCalls += OperationCounters.PhaseCalls[PhaseIndex];
+		}
+
+		if (TotalCalls == 0 && OperationCounters.Records == 0)
+		{
+			continue;
+		}
+		bAnyOperation = true;
+
+		const double RecordsPerSecond = TotalSeconds > 0.0 ? OperationCounters.Records / TotalSeconds : 0.0;
+		UE_LOG(LogGridly, Display, TEXT("  %s: %.1f ms, %lld records (%.0f records/s), %lld bytes sent, %lld bytes received"),
+			GetOperationName(static_cast<EGridlyPerfOperation>(OperationIndex)), TotalSeconds * 1000.0, OperationCounters.Records,
+			RecordsPerSecond, OperationCounters.BytesSent, OperationCounters.BytesReceived);
+
+		for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; PhaseIndex++)
+		{
+			const int32 Calls = OperationCounters.PhaseCalls[PhaseIndex];
+			if (Calls > 0)
+			{
+				const double Milliseconds = OperationCounters.PhaseSeconds[PhaseIndex] * 1000.0;
+				UE_LOG(LogGridly, Display, TEXT("    %s: %d calls, %.1f ms total, %.1f ms avg"),
+					GetPhaseName(static_cast<EGridlyPerfPhase>(PhaseIndex)), Calls, Milliseconds, Milliseconds / Calls);
+			}
+		}
+	}
+
+	if (!bAnyOperation)
+	{
+		UE_LOG(LogGridly, Display, TEXT("  No Gridly operations recorded"));
+	}
+}
+
+const TCHAR* FGridlyPerfCounters::GetOperationName(EGridlyPerfOperation Operation)
+{
+	switch (Operation)
+	{
+	case EGridlyPerfOperation::Import: return TEXT("Import");
+	case EGridlyPerfOperation::Export: return TEXT("Export");
+	case EGridlyPerfOperation::Sync: return TEXT("Sync");
+	case EGridlyPerfOperation::SourceChanges: return TEXT("Source changes");
+	case EGridlyPerfOperation::DataTable: return TEXT("Data table");
+	default: return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FGridlyPerfCounters::GetPhaseName(EGridlyPerfPhase Phase)
+{
+	switch (Phase)
+	{
+	case EGridlyPerfPhase::Http: return TEXT("HTTP");
+	case EGridlyPerfPhase::Parse: return TEXT("Parse");
+	case EGridlyPerfPhase::Convert: return TEXT("Convert");
+	case EGridlyPerfPhase::Diff: return TEXT("Diff");
+	case EGridlyPerfPhase::FileWrite: return TEXT("File write");
+	case EGridlyPerfPhase::StringTableApply: return TEXT("String table apply");
+	default: return TEXT("Unknown");
+	}
+}
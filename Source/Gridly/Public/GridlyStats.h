@@ -0,0 +1,90 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Gridly"), STATGROUP_Gridly, STATCAT_Advanced);
+
+/** Gridly operations that performance counters are kept for */
+enum class EGridlyPerfOperation : uint8
+{
+	Import,
+	Export,
+	Sync,
+	SourceChanges,
+	DataTable,
+	Num
+};
+
+/** Phases of a Gridly operation */
+enum class EGridlyPerfPhase : uint8
+{
+	Http,
+	Parse,
+	Convert,
+	Diff,
+	FileWrite,
+	StringTableApply,
+	Num
+};
+
+/**
+ * Process-wide timing and throughput counters for Gridly operations. Counters are also sent to Unreal Insights as trace
+ * counters and to the Gridly stat group, and LogSummary prints them per operation and phase.
+ */
+class GRIDLY_API FGridlyPerfCounters
+{
+public:
+	static void AddPhaseTime(EGridlyPerfOperation Operation, EGridlyPerfPhase Phase, double Seconds);
+
+	/**
+	 * Records a completed request. Latency is the time from sending the request to receiving the whole response, and bytes
+	 * are counted as they went over the wire, so compressed bodies count with their compressed size
+	 */
+	static void AddHttpRequest(EGridlyPerfOperation Operation, double LatencySeconds, int64 BytesSent, int64 BytesReceived);
+
+	static void AddRecords(EGridlyPerfOperation Operation, int64 NumRecords);
+
+	static void Reset();
+
+	/** Logs time per phase, bytes transferred and records per second for every operation that recorded anything */
+	static void LogSummary();
+
+	static const TCHAR* GetOperationName(EGridlyPerfOperation Operation);
+	static const TCHAR* GetPhaseName(EGridlyPerfPhase Phase);
+};
+
+/** Adds the lifetime of the scope to a phase of an operation */
+class GRIDLY_API FGridlyScopedPerfTimer
+{
+public:
+	FGridlyScopedPerfTimer(EGridlyPerfOperation InOperation, EGridlyPerfPhase InPhase)
+		: Operation(InOperation), Phase(InPhase), StartTime(FPlatformTime::Seconds())
+	{}
+
+	~FGridlyScopedPerfTimer()
+	{
+		FGridlyPerfCounters::AddPhaseTime(Operation, Phase, FPlatformTime::Seconds() - StartTime);
+	}
+
+private:
+	EGridlyPerfOperation Operation;
+	EGridlyPerfPhase Phase;
+	double StartTime;
+};
+
+/** Times the enclosing scope as a CPU trace event, a Gridly cycle stat and in FGridlyPerfCounters */
+#define GRIDLY_PERF_SCOPE(Operation, Phase) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Gridly_##Operation##_##Phase); \
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Gridly " #Operation " " #Phase), STAT_Gridly_##Operation##_##Phase, STATGROUP_Gridly); \
+	FGridlyScopedPerfTimer PREPROCESSOR_JOIN(GridlyPerfTimer, __LINE__)(EGridlyPerfOperation::Operation, EGridlyPerfPhase::Phase)
+
+/** Records a completed request of an operation from its request and response, which may be invalid when the request failed */
+#define GRIDLY_PERF_HTTP(Operation, Request, Response) \
+	FGridlyPerfCounters::AddHttpRequest(EGridlyPerfOperation::Operation, \
+		(Request).IsValid() ? (Request)->GetElapsedTime() : 0.0, \
+		(Request).IsValid() ? (Request)->GetContent().Num() : 0, \
+		(Response).IsValid() ? (Response)->GetContent().Num() : 0)
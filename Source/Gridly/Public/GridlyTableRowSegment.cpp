@@ -0,0 +1,203 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyTableRowSegment.h"
+
+#include "Gridly.h"
+#include "GridlyGameSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GridlyTableRowSegment
+{
+	static void SerializeRow(FArchive& Ar, FGridlyTableRow& Row)
+	{
+		Ar << Row.Id << Row.Path;
+
+		int32 NumCells = Row.Cells.Num();
+		Ar << NumCells;
+		if (Ar.IsLoading())
+		{
+			Row.Cells.SetNum(FMath::Max(0, NumCells));
+		}
+
+		for (FGridlyTableCell& Cell : Row.Cells)
+		{
+			Ar << Cell.ColumnId << Cell.DependencyStatus << Cell.Value;
+		}
+	}
+}
+
+FGridlyTableRowSegment::~FGridlyTableRowSegment()
+{
+	if (IsSpilled())
+	{
+		IFileManager::Get().Delete(*SegmentPath, false, false, true);
+	}
+}
+
+void FGridlyTableRowSegment::Reset()
+{
+	if (IsSpilled())
+	{
+		IFileManager::Get().Delete(*SegmentPath, false, false, true);
+	}
+
+	Rows.Empty();
+	NumRows = 0;
+	RowsInMemoryBytes = 0;
+	MemoryBudgetBytes = static_cast<int64>(FMath::Max(0, GetDefault<UGridlyGameSettings>()->DownloadMemoryBudgetMB)) * 1024 * 1024;
+	SegmentPath.Reset();
+	SegmentBytes = 0;
+	bWriteFailed = false;
+}
+
+void FGridlyTableRowSegment::AppendPage(TArray<FGridlyTableRow>&& Page)
+{
+	NumRows += Page.Num();
+
+	if (IsSpilled() && !bWriteFailed && WritePage(Page))
+	{
+		return;
+	}
+
+	RowsInMemoryBytes += GetAllocatedSize(Page);
+	Rows.Append(MoveTemp(Page));
+
+	if (MemoryBudgetBytes > 0 && RowsInMemoryBytes > MemoryBudgetBytes && !IsSpilled() && !bWriteFailed)
+	{
+		SegmentPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Gridly"), TEXT("Segments"),
+			FGuid::NewGuid().ToString(EGuidFormats::Digits) + TEXT(".bin"));
+
+		UE_LOG(LogGridly, Log, TEXT("Downloaded rows exceed the memory budget of %lld bytes, moving %d rows to: %s"),
+			MemoryBudgetBytes, Rows.Num(), *SegmentPath);
+
+		if (WritePage(Rows))
+		{
+			Rows.Empty();
+			RowsInMemoryBytes = 0;
+		}
+		else
+		{
+			// Nothing was moved, so the rows stay in memory and the file is not read
+			IFileManager::Get().Delete(*SegmentPath, false, false, true);
+			SegmentPath.Reset();
+			SegmentBytes = 0;
+		}
+	}
+}
+
+bool FGridlyTableRowSegment::ForEachPage(TFunctionRef<void(const TArray<FGridlyTableRow>&)> Visitor) const
+{
+	if (IsSpilled())
+	{
+		const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SegmentPath));
+		if (!Reader)
+		{
+			UE_LOG(LogGridly, Error, TEXT("Failed to open segment file: %s"), *SegmentPath);
+			return false;
+		}
+
+		TArray<uint8> PageBytes;
+		TArray<FGridlyTableRow> Page;
+		while (!Reader->IsError() && Reader->Tell() < SegmentBytes)
+		{
+			int64 NumPageBytes = 0;
+			*Reader << NumPageBytes;
+			if (NumPageBytes < 0 || NumPageBytes > MAX_int32 || Reader->Tell() + NumPageBytes > SegmentBytes)
+			{
+				Reader->SetError();
+			}
+
+			if (Reader->IsError())
+			{
+				break;
+			}
+
+			PageBytes.SetNumUninitialized(static_cast<int32>(NumPageBytes));
+			Reader->Serialize(PageBytes.GetData(), NumPageBytes);
+			if (Reader->IsError())
+			{
+				break;
+			}
+
+			FMemoryReader PageReader(PageBytes);
+			int32 NumPageRows = 0;
+			PageReader << NumPageRows;
+			Page.SetNum(FMath::Max(0, NumPageRows));
+			for (FGridlyTableRow& Row : Page)
+			{
+				GridlyTableRowSegment::SerializeRow(PageReader, Row);
+			}
+
+			if (NumPageRows < 0 || PageReader.IsError())
+			{
+				Reader->SetError();
+				break;
+			}
+
+			Visitor(Page);
+		}
+
+		if (Reader->IsError())
+		{
+			UE_LOG(LogGridly, Error, TEXT("Failed to read segment file: %s"), *SegmentPath);
+			return false;
+		}
+	}
+
+	// Rows only stay in memory after the segment file, when it could not be written
+	if (Rows.Num() > 0)
+	{
+		Visitor(Rows);
+	}
+
+	return true;
+}
+
+bool FGridlyTableRowSegment::WritePage(const TArray<FGridlyTableRow>& Page)
+{
+	// The page is serialized first, so it is appended with its length in one write
+	TArray<uint8> PageBytes;
+	FMemoryWriter PageWriter(PageBytes);
+	int32 NumPageRows = Page.Num();
+	PageWriter << NumPageRows;
+	for (const FGridlyTableRow& Row : Page)
+	{
+		GridlyTableRowSegment::SerializeRow(PageWriter, const_cast<FGridlyTableRow&>(Row));
+	}
+
+	const TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*SegmentPath, FILEWRITE_Append));
+	if (Writer)
+	{
+		int64 NumPageBytes = PageBytes.Num();
+		*Writer << NumPageBytes;
+		Writer->Serialize(PageBytes.GetData(), PageBytes.Num());
+	}
+
+	if (!Writer || Writer->IsError() || !Writer->Close())
+	{
+		UE_LOG(LogGridly, Warning, TEXT("Failed to write segment file, keeping downloaded rows in memory: %s"), *SegmentPath);
+		bWriteFailed = true;
+		return false;
+	}
+
+	SegmentBytes += sizeof(int64) + PageBytes.Num();
+	return true;
+}
+
+int64 FGridlyTableRowSegment::GetAllocatedSize(const TArray<FGridlyTableRow>& Page)
+{
+	int64 Bytes = Page.GetAllocatedSize();
+	for (const FGridlyTableRow& Row : Page)
+	{
+		Bytes += Row.Id.GetAllocatedSize() + Row.Path.GetAllocatedSize() + Row.Cells.GetAllocatedSize();
+		for (const FGridlyTableCell& Cell : Row.Cells)
+		{
+			Bytes += Cell.ColumnId.GetAllocatedSize() + Cell.DependencyStatus.GetAllocatedSize() + Cell.Value.GetAllocatedSize();
+		}
+	}
+
+	return Bytes;
+}
@@ -0,0 +1,52 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridlyTableRow.h"
+
+/**
+ * Records downloaded from Gridly a page at a time. Pages stay in memory until they exceed the DownloadMemoryBudgetMB
+ * setting. After that, every row moves to a compact segment file under Saved/Gridly/Segments and later pages are
+ * appended to it. Each page is stored with its length and only counts once it was written completely, so a failed write
+ * never leaves a partial page behind. Consumers stream through the rows a page at a time with ForEachPage.
+ */
+class GRIDLY_API FGridlyTableRowSegment
+{
+public:
+	FGridlyTableRowSegment() = default;
+	~FGridlyTableRowSegment();
+
+	/** Deletes all rows, along with the segment file, and reads the memory budget */
+	void Reset();
+
+	void AppendPage(TArray<FGridlyTableRow>&& Page);
+
+	int32 Num() const { return NumRows; }
+	bool IsSpilled() const { return !SegmentPath.IsEmpty(); }
+
+	/** Rows not written to the segment file, which is every row unless the memory budget was exceeded */
+	const TArray<FGridlyTableRow>& GetRowsInMemory() const { return Rows; }
+
+	/** Calls Visitor with every row in download order, a page at a time. Returns false if the segment file could not be read */
+	bool ForEachPage(TFunctionRef<void(const TArray<FGridlyTableRow>&)> Visitor) const;
+
+private:
+	bool WritePage(const TArray<FGridlyTableRow>& Page);
+	static int64 GetAllocatedSize(const TArray<FGridlyTableRow>& Page);
+
+	TArray<FGridlyTableRow> Rows;
+	int32 NumRows = 0;
+	int64 RowsInMemoryBytes = 0;
+
+	/** Zero for no budget */
+	int64 MemoryBudgetBytes = 0;
+
+	FString SegmentPath;
+
+	/** Length of the pages written completely, anything after it is left over from a failed write */
+	int64 SegmentBytes = 0;
+
+	/** Set once a write failed, after which pages stay in memory so rows keep their order */
+	bool bWriteFailed = false;
+};
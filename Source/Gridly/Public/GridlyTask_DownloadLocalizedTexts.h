@@ -2,7 +2,12 @@
 
 #pragma once
 
+#include "GridlyBatchSizer.h"
+#include "GridlyCancellationToken.h"
+#include "GridlyDownloadCheckpoint.h"
+#include "GridlyDownloadProgress.h"
 #include "GridlyResult.h"
+#include "GridlyTextRecordStore.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Internationalization/PolyglotTextData.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
@@ -14,8 +19,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FDownloadLocalizedTextsDelegate,
 	float, Progress, const FGridlyResult&, Error);
 
 DECLARE_DELEGATE_OneParam(FDownloadLocalizedTextsSuccessDelegate, const TArray<FPolyglotTextData>&);
-DECLARE_DELEGATE_TwoParams(FDownloadLocalizedTextsProgressDelegate, const TArray<FPolyglotTextData>&, float);
+DECLARE_DELEGATE_TwoParams(FDownloadLocalizedTextsProgressDelegate, const TArray<FPolyglotTextData>&,
+	const FGridlyDownloadProgress&);
 DECLARE_DELEGATE_TwoParams(FDownloadLocalizedTextsFailDelegate, const TArray<FPolyglotTextData>&, const FGridlyResult&);
+DECLARE_DELEGATE_OneParam(FDownloadLocalizedTextsRecordStoreSuccessDelegate, FGridlyTextRecordStore&);
 
 UCLASS()
 class GRIDLY_API UGridlyTask_DownloadLocalizedTexts : public UBlueprintAsyncActionBase
@@ -30,6 +37,16 @@ public:
 	void RequestPage(const int ViewIdIndex, const int Offset);
 	void OnProcessRequestComplete(FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bSuccess);
 
+	/** Adds a parsed page to the records and requests the next one, on the game thread */
+	void OnPageParsed(bool bParsed, const TArray<FGridlyTableRow>& TableRows, const FString& Content, int ViewIdTotalCount,
+		int32 NumContentBytes, float ElapsedTime);
+
+	/** Stops the download and broadcasts OnFail, unless it already finished */
+	void Cancel();
+
+	/** Checked before each page is requested and when it arrives, the download is cancelled once the token is */
+	FGridlyCancellationToken CancellationToken;
+
 public:
 	UFUNCTION(Category = Gridly, BlueprintCallable, meta = (BlueprintInternalUseOnly = true, WorldContext = "WorldContextObject"))
 	static UGridlyTask_DownloadLocalizedTexts* DownloadLocalizedTexts(const UObject* WorldContextObject);
@@ -38,6 +55,7 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FDownloadLocalizedTextsDelegate OnSuccess;
 
+	/** Receives only the texts of the page that just arrived, OnSuccess receives all of them */
 	UPROPERTY(BlueprintAssignable)
 	FDownloadLocalizedTextsDelegate OnProgress;
 
@@ -45,19 +63,59 @@ public:
 	FDownloadLocalizedTextsDelegate OnFail;
 
 	FDownloadLocalizedTextsSuccessDelegate OnSuccessDelegate;
+	/** Receives the texts of the page that just arrived and the download's counters */
 	FDownloadLocalizedTextsProgressDelegate OnProgressDelegate;
 	FDownloadLocalizedTextsFailDelegate OnFailDelegate;;
 
+	/**
+	 * Native success callback that receives the compact record store, without expanding it into FPolyglotTextData.
+	 * The store is released after the callback, which may move it out to keep it.
+	 */
+	FDownloadLocalizedTextsRecordStoreSuccessDelegate OnRecordStoreSuccessDelegate;
+
+	/** When false, pages are requested back to back, for servers such as a local stand-in that need no rate limiting */
+	bool bThrottleRequests = true;
+
+	/** Added to the checkpoint name to keep apart downloads that run at the same time, such as one per localization target */
+	FString CheckpointKey;
+
 private:
 	FHttpRequestPtr HttpRequest;
 	const UObject* WorldContextObject;
 
 	int Limit;
 	int TotalCount;
+	FGridlyBatchSizer BatchSizer;
 
 	TArray<FString> ViewIds;
+
+	/** Columns requested from every view, empty to request all of them */
+	TArray<FString> ColumnIds;
 	int CurrentViewIdIndex;
 	int CurrentOffset;
 
+	FGridlyDownloadCheckpoint Checkpoint;
+
+	/** Set while the first page after resuming from a checkpoint is outstanding */
+	bool bVerifyCheckpoint = false;
+
+	/** Replays the checkpointed pages into TextRecords and returns where the download continues */
+	void ResumeFromCheckpoint(int& OutViewIdIndex, int& OutOffset);
+
+	/** Passes the records from FirstPageRecordIndex on to the progress delegates */
+	void BroadcastProgress(float Progress, int32 FirstPageRecordIndex);
+	void BroadcastFail(const FGridlyResult& FailResult);
+	const TArray<FPolyglotTextData>& GetPolyglotTextDatas();
+
+	/** Releases the texts and the root reference once the delegates had the result, so the task can be collected */
+	void Finish();
+	bool bFinished = false;
+
+	FGridlyTextRecordStore TextRecords;
+
+	/** Texts expanded from TextRecords, only filled in when array delegates are bound */
 	TArray<FPolyglotTextData> PolyglotTextDatas;
+
+	/** Texts of the latest page, expanded for the progress delegates */
+	TArray<FPolyglotTextData> PagePolyglotTextDatas;
 };
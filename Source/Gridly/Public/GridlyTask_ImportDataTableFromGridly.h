@@ -2,21 +2,30 @@
 
 #pragma once
 
+#include "GridlyBatchSizer.h"
+#include "GridlyCancellationToken.h"
 #include "GridlyDataTable.h"
+#include "GridlyDownloadProgress.h"
 #include "GridlyResult.h"
 #include "GridlyTableRow.h"
+#include "GridlyTableRowSegment.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
 
 #include "GridlyTask_ImportDataTableFromGridly.generated.h"
 
+struct FGridlyDataTableImportChanges;
+
 UDELEGATE()
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FImportDataTableFromGridlyDelegate, const TArray<FGridlyTableRow>&, GridlyTableRows,
 	float, Progress, const FGridlyResult&, Error);
 
 DECLARE_DELEGATE_OneParam(FImportDataTableFromGridlySuccessDelegate, const TArray<FGridlyTableRow>&);
-DECLARE_DELEGATE_TwoParams(FImportDataTableFromGridlyProgressDelegate, const TArray<FGridlyTableRow>&, float);
+DECLARE_DELEGATE_TwoParams(FImportDataTableFromGridlyProgressDelegate, const TArray<FGridlyTableRow>&,
+	const FGridlyDownloadProgress&);
 DECLARE_DELEGATE_TwoParams(FImportDataTableFromGridlyFailDelegate, const TArray<FGridlyTableRow>&, const FGridlyResult&);
+DECLARE_DELEGATE_OneParam(FImportDataTableFromGridlySegmentSuccessDelegate, const FGridlyTableRowSegment&);
+DECLARE_DELEGATE_OneParam(FImportDataTableFromGridlyTableChangeDelegate, bool /* bRowListChanged */);
 
 UCLASS()
 class GRIDLY_API UGridlyTask_ImportDataTableFromGridly : public UBlueprintAsyncActionBase
@@ -31,37 +40,69 @@ public:
 	void RequestPage(const int ViewIdIndex, const int Offset);
 	void OnProcessRequestComplete(FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bSuccess);
 
+	/** Stops the import and broadcasts OnFail, unless it already finished */
+	void Cancel();
+
+	/** Checked before each page is requested and when it arrives, the import is cancelled once the token is */
+	FGridlyCancellationToken CancellationToken;
+
 public:
 	UFUNCTION(Category = Gridly, BlueprintCallable, meta = (BlueprintInternalUseOnly = true, WorldContext = "WorldContextObject"))
 	static UGridlyTask_ImportDataTableFromGridly* ImportDataTableFromGridly(const UObject* WorldContextObject,
 		UGridlyDataTable* GridlyDataTable);
 
 public:
+	/**
+	 * Receives every downloaded row. Rows moved to disk because the download exceeded DownloadMemoryBudgetMB are read back
+	 * for it, so native code that does not need them all at once should bind OnSegmentSuccessDelegate instead.
+	 */
 	UPROPERTY(BlueprintAssignable)
 	FImportDataTableFromGridlyDelegate OnSuccess;
 
+	/** Receives only the rows of the page that just arrived */
 	UPROPERTY(BlueprintAssignable)
 	FImportDataTableFromGridlyDelegate OnProgress;
 
 	UPROPERTY(BlueprintAssignable)
 	FImportDataTableFromGridlyDelegate OnFail;
 
+	/** Same rows as OnSuccess */
 	FImportDataTableFromGridlySuccessDelegate OnSuccessDelegate;
+	/** Native success callback that streams through the rows with ForEachPage, without reading spilled rows back at once */
+	FImportDataTableFromGridlySegmentSuccessDelegate OnSegmentSuccessDelegate;
+	/**
+	 * Called right before the downloaded rows are written to the table. bRowListChanged is false when a diff import only
+	 * modifies existing rows. Diff imports that change nothing skip it.
+	 */
+	FImportDataTableFromGridlyTableChangeDelegate OnPreTableChangeDelegate;
+	/** Called once the table was written, after OnPreTableChangeDelegate */
+	FImportDataTableFromGridlyTableChangeDelegate OnPostTableChangeDelegate;
+	/** Receives the rows of the page that just arrived and the download's counters */
 	FImportDataTableFromGridlyProgressDelegate OnProgressDelegate;
-	FImportDataTableFromGridlyFailDelegate OnFailDelegate;;
+	FImportDataTableFromGridlyFailDelegate OnFailDelegate;
 
 private:
+	void LogImportChanges(const FGridlyDataTableImportChanges& Changes) const;
+	void BroadcastProgress(const TArray<FGridlyTableRow>& PageRows, float Progress);
+	void BroadcastFail(const FGridlyResult& FailResult);
+
+	/** Releases the rows and the root reference once the delegates had the result, so the task can be collected */
+	void Finish();
+	bool bFinished = false;
+
 	FHttpRequestPtr HttpRequest;
 	const UObject* WorldContextObject;
 
 	int Limit;
 	int TotalCount;
+	FGridlyBatchSizer BatchSizer;
 
 	TArray<FString> ViewIds;
 	int CurrentViewIdIndex;
 	int CurrentOffset;
 
-	TArray<FGridlyTableRow> GridlyTableRows;
+	/** Downloaded rows, delegates receive the ones still in memory */
+	FGridlyTableRowSegment GridlyTableRows;
 
 	UPROPERTY()
 	UGridlyDataTable* GridlyDataTable;
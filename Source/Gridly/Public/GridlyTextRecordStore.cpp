@@ -0,0 +1,249 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyTextRecordStore.h"
+
+#include "Gridly.h"
+#include "GridlyCultureConverter.h"
+#include "GridlyGameSettings.h"
+#include "GridlyTableRow.h"
+#include "Internationalization/PolyglotTextData.h"
+
+void FGridlyTextRecordStore::Reset(const TArray<FString>& InAvailableCultures)
+{
+	AvailableCultures = InAvailableCultures;
+	Arena.Reset();
+	Namespaces.Reset();
+	Cultures.Reset();
+	ColumnIds.Reset();
+	ColumnInfos.Reset();
+	RecordIds.Reset();
+	NamespaceIndices.Reset();
+	Keys.Reset();
+	NativeStrings.Reset();
+	NativeCultureIndices.Reset();
+	LocalizedStrings.Reset();
+}
+
+int32 FGridlyTextRecordStore::AppendTableRows(const TArray<FGridlyTableRow>& TableRows)
+{
+	UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
+
+	const bool bUseCombinedNamespaceKey = GameSettings->bUseCombinedNamespaceId;
+	const bool bUsePathAsNamespace = !bUseCombinedNamespaceKey && GameSettings->NamespaceColumnId == "path";
+
+	const int32 FirstRecordIndex = Num();
+	TMap<FString, int32> BatchRecordIndices;
+	BatchRecordIndices.Reserve(TableRows.Num());
+
+	TArray<TPair<int32, const FString*>> Translations;
+
+	for (int i = 0; i < TableRows.Num(); i++)
+	{
+		UE_LOG(LogGridly, Verbose, TEXT("Row %d: %s (%s)"), i, *TableRows[i].Id, *TableRows[i].Path);
+
+		FString Key = TableRows[i].Id;
+		const FString& FullKey = TableRows[i].Id;
+		FString Namespace = bUsePathAsNamespace ? TableRows[i].Path : TEXT("");
+		int32 SourceCultureIndex = INDEX_NONE;
+		const FString* SourceText = nullptr;
+		Translations.Reset();
+
+		for (int j = 0; j < TableRows[i].Cells.Num(); j++)
+		{
+			const FGridlyTableCell& GridlyTableCell = TableRows[i].Cells[j];
+			const FColumnInfo& ColumnInfo = GetColumnInfo(GridlyTableCell.ColumnId, bUsePathAsNamespace);
+
+			switch (ColumnInfo.Kind)
+			{
+			case EColumnKind::Namespace:
+				Namespace = GridlyTableCell.Value;
+				break;
+			case EColumnKind::Source:
+				SourceCultureIndex = ColumnInfo.CultureIndex;
+				SourceText = &GridlyTableCell.Value;
+				break;
+			case EColumnKind::Target:
+				Translations.Emplace(ColumnInfo.CultureIndex, &GridlyTableCell.Value);
+				break;
+			default:
+				break;
+			}
+		}
+
+		// Namespace / key fixes
+
+		if (bUseCombinedNamespaceKey)
+		{
+			FString NewKey;
+			if (Key.Split(",", &Namespace, &NewKey))
+			{
+				Key = NewKey;
+			}
+		}
+
+		Namespace = Namespace.Replace(TEXT(" "), TEXT(""));
+
+		if (!SourceText || SourceText->IsEmpty() || SourceCultureIndex == INDEX_NONE)
+		{
+			UE_LOG(LogGridly, Warning, TEXT("Could not find native culture/source string in imported text with key: %s,%s"),
+				*Namespace, *Key);
+		}
+
+		int32 RecordIndex;
+		if (const int32* ExistingRecordIndex = BatchRecordIndices.Find(FullKey))
+		{
+			RecordIndex = *ExistingRecordIndex;
+			for (TArray<FSpan>& CultureColumn : LocalizedStrings)
+			{
+				CultureColumn[RecordIndex] = FSpan();
+			}
+		}
+		else
+		{
+			RecordIndex = RecordIds.AddDefaulted();
+			NamespaceIndices.AddDefaulted();
+			Keys.AddDefaulted();
+			NativeStrings.AddDefaulted();
+			NativeCultureIndices.AddDefaulted();
+			for (TArray<FSpan>& CultureColumn : LocalizedStrings)
+			{
+				CultureColumn.AddDefaulted();
+			}
+
+			BatchRecordIndices.Add(FullKey, RecordIndex);
+		}
+
+		RecordIds[RecordIndex] = AddString(FullKey);
+		NamespaceIndices[RecordIndex] = Namespaces.Intern(Namespace);
+		Keys[RecordIndex] = AddString(Key);
+		NativeStrings[RecordIndex] = SourceText ? AddString(*SourceText) : AddString(FString());
+		NativeCultureIndices[RecordIndex] = SourceCultureIndex;
+
+		// Later columns for the same culture win, and empty translations count as missing
+		for (const TPair<int32, const FString*>& Translation : Translations)
+		{
+			LocalizedStrings[Translation.Key][RecordIndex] = Translation.Value->IsEmpty() ? FSpan() : AddString(*Translation.Value);
+		}
+	}
+
+	return Num() - FirstRecordIndex;
+}
+
+FString FGridlyTextRecordStore::GetNativeCulture(int32 RecordIndex) const
+{
+	const int32 CultureIndex = NativeCultureIndices[RecordIndex];
+	return CultureIndex != INDEX_NONE ? Cultures[CultureIndex] : FString();
+}
+
+bool FGridlyTextRecordStore::GetLocalizedString(int32 RecordIndex, int32 CultureIndex, FStringView& OutLocalizedString) const
+{
+	if (!LocalizedStrings.IsValidIndex(CultureIndex))
+	{
+		return false;
+	}
+
+	const FSpan& Span = LocalizedStrings[CultureIndex][RecordIndex];
+	if (Span.Len == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLocalizedString = ToView(Span);
+	return true;
+}
+
+FPolyglotTextData FGridlyTextRecordStore::ToPolyglotTextData(int32 RecordIndex) const
+{
+	FPolyglotTextData PolyglotTextData(ELocalizedTextSourceCategory::Game, FString(GetNamespace(RecordIndex)),
+		FString(GetKey(RecordIndex)), FString(GetNativeString(RecordIndex)), GetNativeCulture(RecordIndex));
+
+	for (int32 CultureIndex = 0; CultureIndex < Cultures.Num(); CultureIndex++)
+	{
+		FStringView LocalizedString;
+		if (GetLocalizedString(RecordIndex, CultureIndex, LocalizedString))
+		{
+			PolyglotTextData.AddLocalizedString(Cultures[CultureIndex], FString(LocalizedString));
+		}
+	}
+
+	return PolyglotTextData;
+}
+
+void FGridlyTextRecordStore::AppendPolyglotTextDatas(TArray<FPolyglotTextData>& OutPolyglotTextDatas, int32 StartIndex) const
+{
+	OutPolyglotTextDatas.Reserve(OutPolyglotTextDatas.Num() + FMath::Max(0, Num() - StartIndex));
+	for (int32 RecordIndex = StartIndex; RecordIndex < Num(); RecordIndex++)
+	{
+		OutPolyglotTextDatas.Add(ToPolyglotTextData(RecordIndex));
+	}
+}
+
+FGridlyTextRecordStore::FSpan FGridlyTextRecordStore::AddString(const FString& String)
+{
+	FSpan Span;
+	Span.Offset = Arena.Num();
+	Span.Len = String.Len();
+	Arena.Append(*String, String.Len());
+	return Span;
+}
+
+FStringView FGridlyTextRecordStore::ToView(const FSpan& Span) const
+{
+	return Span.Len > 0 ? FStringView(Arena.GetData() + Span.Offset, Span.Len) : FStringView();
+}
+
+int32 FGridlyTextRecordStore::InternCulture(const FString& Culture)
+{
+	int32 CultureIndex = Cultures.IndexOfByKey(Culture);
+	if (CultureIndex == INDEX_NONE)
+	{
+		CultureIndex = Cultures.Add(Culture);
+		LocalizedStrings.AddDefaulted_GetRef().SetNum(Num());
+	}
+
+	return CultureIndex;
+}
+
+const FGridlyTextRecordStore::FColumnInfo& FGridlyTextRecordStore::GetColumnInfo(const FString& ColumnId, bool bUsePathAsNamespace)
+{
+	const int32 ColumnHandle = ColumnIds.Intern(ColumnId);
+	if (ColumnInfos.IsValidIndex(ColumnHandle))
+	{
+		return ColumnInfos[ColumnHandle];
+	}
+
+	const UGridlyGameSettings* GameSettings = GetDefault<UGridlyGameSettings>();
+	FColumnInfo& ColumnInfo = ColumnInfos.AddDefaulted_GetRef();
+
+	// If special columns
+
+	if (!bUsePathAsNamespace && ColumnId == GameSettings->NamespaceColumnId)
+	{
+		ColumnInfo.Kind = EColumnKind::Namespace;
+		return ColumnInfo;
+	}
+
+	// If language column
+
+	FString Culture;
+	if (ColumnId.StartsWith(GameSettings->SourceLanguageColumnIdPrefix))
+	{
+		const FString GridlyCulture = ColumnId.RightChop(GameSettings->SourceLanguageColumnIdPrefix.Len());
+		if (FGridlyCultureConverter::ConvertFromGridly(AvailableCultures, GridlyCulture, Culture))
+		{
+			ColumnInfo.Kind = EColumnKind::Source;
+			ColumnInfo.CultureIndex = InternCulture(Culture);
+		}
+	}
+	else if (ColumnId.StartsWith(GameSettings->TargetLanguageColumnIdPrefix))
+	{
+		const FString GridlyCulture = ColumnId.RightChop(GameSettings->TargetLanguageColumnIdPrefix.Len());
+		if (FGridlyCultureConverter::ConvertFromGridly(AvailableCultures, GridlyCulture, Culture))
+		{
+			ColumnInfo.Kind = EColumnKind::Target;
+			ColumnInfo.CultureIndex = InternCulture(Culture);
+		}
+	}
+
+	return ColumnInfo;
+}
@@ -0,0 +1,90 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridlyInternTable.h"
+
+struct FGridlyTableRow;
+struct FPolyglotTextData;
+
+/**
+ * Compact store for texts downloaded from Gridly. All strings share one character arena, namespaces and cultures are
+ * interned, and translations are kept as one dense column per culture. Texts are only expanded into FPolyglotTextData
+ * where Blueprints or the text localization manager need them.
+ */
+class GRIDLY_API FGridlyTextRecordStore
+{
+public:
+	FGridlyTextRecordStore() = default;
+
+	/** Clears the store. Gridly culture columns are resolved against AvailableCultures */
+	void Reset(const TArray<FString>& AvailableCultures);
+
+	/** Parses records into texts, returning how many were added. A repeated record ID in the same batch replaces the earlier one */
+	int32 AppendTableRows(const TArray<FGridlyTableRow>& TableRows);
+
+	int32 Num() const { return Keys.Num(); }
+
+	const TArray<FString>& GetCultures() const { return Cultures; }
+	int32 FindCulture(const FString& Culture) const { return Cultures.IndexOfByKey(Culture); }
+
+	FStringView GetRecordId(int32 RecordIndex) const { return ToView(RecordIds[RecordIndex]); }
+	FStringView GetNamespace(int32 RecordIndex) const { return Namespaces.Resolve(NamespaceIndices[RecordIndex]); }
+	FStringView GetKey(int32 RecordIndex) const { return ToView(Keys[RecordIndex]); }
+	FStringView GetNativeString(int32 RecordIndex) const { return ToView(NativeStrings[RecordIndex]); }
+	FString GetNativeCulture(int32 RecordIndex) const;
+	bool GetLocalizedString(int32 RecordIndex, int32 CultureIndex, FStringView& OutLocalizedString) const;
+
+	FPolyglotTextData ToPolyglotTextData(int32 RecordIndex) const;
+
+	/** Converts records from StartIndex on, so a growing store can be converted incrementally */
+	void AppendPolyglotTextDatas(TArray<FPolyglotTextData>& OutPolyglotTextDatas, int32 StartIndex = 0) const;
+
+private:
+	struct FSpan
+	{
+		int32 Offset = 0;
+		int32 Len = INDEX_NONE;
+	};
+
+	enum class EColumnKind : uint8
+	{
+		Other,
+		Namespace,
+		Source,
+		Target
+	};
+
+	struct FColumnInfo
+	{
+		EColumnKind Kind = EColumnKind::Other;
+		int32 CultureIndex = INDEX_NONE;
+	};
+
+	FSpan AddString(const FString& String);
+	FStringView ToView(const FSpan& Span) const;
+	int32 InternCulture(const FString& Culture);
+
+	/** Classifies a column ID once, every later cell with the same column ID reuses the result */
+	const FColumnInfo& GetColumnInfo(const FString& ColumnId, bool bUsePathAsNamespace);
+
+	TArray<FString> AvailableCultures;
+	TArray<TCHAR> Arena;
+
+	FGridlyInternTable Namespaces;
+	TArray<FString> Cultures;
+
+	FGridlyInternTable ColumnIds;
+	TArray<FColumnInfo> ColumnInfos;
+
+	// One entry per record
+	TArray<FSpan> RecordIds;
+	TArray<int32> NamespaceIndices;
+	TArray<FSpan> Keys;
+	TArray<FSpan> NativeStrings;
+	TArray<int32> NativeCultureIndices;
+
+	// One column per culture with one entry per record, Len is INDEX_NONE where there is no translation
+	TArray<TArray<FSpan>> LocalizedStrings;
+};
@@ -29,7 +29,9 @@ public class GridlyEditor : ModuleRules
 				"Localization",
 				"LocalizationCommandletExecution",
 				"MainFrame",
+				"MessageLog",
 				"DesktopPlatform",
+				"HTTPServer",
 				"Gridly"
 			}
 		);
@@ -5,6 +5,8 @@
 #include "AssetTypeActions_CSVAssetBase.h"
 #include "DataTableEditorUtils.h"
 #include "DesktopPlatformModule.h"
+#include "GridlyApi.h"
+#include "GridlyBackgroundJob.h"
 #include "GridlyEditor.h"
 #include "GridlyExporter.h"
 #include "GridlyGameSettings.h"
@@ -282,68 +284,88 @@ void FAssetTypeActions_GridlyDataTable::ImportFromGridly(UGridlyDataTable* DataT
 	UGridlyDataTable* GridlyDataTable = Cast<UGridlyDataTable>(DataTable);
 	check(GridlyDataTable);
 
-	const TSharedPtr<FScopedSlowTask, ESPMode::ThreadSafe> ImportDataTableFromGridlySlowTask = MakeShareable(new FScopedSlowTask(1.f,
-		LOCTEXT("ImportGridlyDataTableSlowTask", "Importing data table from Gridly")));
-	auto& SlowTask = ImportSlowTasks.Add(DataTable->GetUniqueID(), ImportDataTableFromGridlySlowTask);
-
-	SlowTask->MakeDialog();
+	// The table is only written once every page arrived, a second import meanwhile would race the first
+	const uint32 TableId = DataTable->GetUniqueID();
+	if (const TSharedPtr<FGridlyBackgroundJob>* RunningJob = ImportJobs.Find(TableId); RunningJob && !(*RunningJob)->IsFinished())
+	{
+		UE_LOG(LogGridlyEditor, Warning, TEXT("%s is already being imported from Gridly"), *DataTable->GetName());
+		return;
+	}
 
 	UGridlyTask_ImportDataTableFromGridly* Task =
 		UGridlyTask_ImportDataTableFromGridly::ImportDataTableFromGridly(nullptr, GridlyDataTable);
 
-	FDataTableEditorUtils::BroadcastPreChange(GridlyDataTable, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+	// The toast's cancel button is checked with each page, the task stops when the page it is waiting for arrives
+	const TSharedPtr<FGridlyBackgroundJob> Job = MakeShared<FGridlyBackgroundJob>(
+		FText::Format(LOCTEXT("ImportGridlyDataTableJob", "Importing {0} from Gridly"), FText::FromString(DataTable->GetName())),
+		FSimpleDelegate::CreateLambda([CancellationToken = Task->CancellationToken]() mutable
+		{
+			CancellationToken.Cancel();
+		}));
+	ImportJobs.Add(TableId, Job);
+
+	// Only the final write touches the table, diff imports that change nothing or only row contents notify less
+	Task->OnPreTableChangeDelegate.BindLambda([GridlyDataTable](bool bRowListChanged)
+	{
+		FDataTableEditorUtils::BroadcastPreChange(GridlyDataTable, bRowListChanged
+			? FDataTableEditorUtils::EDataTableChangeInfo::RowList
+			: FDataTableEditorUtils::EDataTableChangeInfo::RowData);
+	});
+	Task->OnPostTableChangeDelegate.BindLambda([GridlyDataTable](bool bRowListChanged)
+	{
+		FDataTableEditorUtils::BroadcastPostChange(GridlyDataTable, bRowListChanged
+			? FDataTableEditorUtils::EDataTableChangeInfo::RowList
+			: FDataTableEditorUtils::EDataTableChangeInfo::RowData);
+	});
 
 	Task->OnProgressDelegate.BindLambda(
-		[GridlyDataTable, &SlowTask](const TArray<FGridlyTableRow>& GridlyTableRows, float Progress) mutable
+		[Job](const TArray<FGridlyTableRow>& PageRows, const FGridlyDownloadProgress& Progress)
 		{
-			const float Delta = Progress - SlowTask->CompletedWork;
-			SlowTask->EnterProgressFrame(Delta);
+			Job->SetProgress(FText::Format(LOCTEXT("ImportGridlyDataTableProgress", "{0} of {1} records downloaded"),
+				Progress.NumRecords, Progress.TotalCount));
 		});
 
-	Task->OnSuccessDelegate.BindLambda(
-		[GridlyDataTable, &SlowTask](const TArray<FGridlyTableRow>& GridlyTableRows) mutable
+	Task->OnSegmentSuccessDelegate.BindLambda(
+		[Job, TableId](const FGridlyTableRowSegment& GridlyTableRows)
 		{
-			SlowTask.Reset();
-			FDataTableEditorUtils::BroadcastPostChange(GridlyDataTable, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+			Job->Complete(LOCTEXT("ImportGridlyDataTableComplete", "Imported data table from Gridly"));
+			ImportJobs.Remove(TableId);
 		});
 
 	Task->OnFailDelegate.BindLambda(
-		[GridlyDataTable, &SlowTask](const TArray<FGridlyTableRow>& GridlyTableRows,
-		const FGridlyResult& GridlyResult) mutable
+		[Job, TableId, CancellationToken = Task->CancellationToken](const TArray<FGridlyTableRow>& GridlyTableRows,
+		const FGridlyResult& GridlyResult)
 		{
-			SlowTask.Reset();
-			FDataTableEditorUtils::BroadcastPostChange(GridlyDataTable, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
-
-			const FString ErrorMessage = GridlyResult.Message;
-			UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorMessage);
-			FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ErrorMessage));
+			// The user asked for it, so a cancelled import is no error
+			if (CancellationToken.IsCancelled())
+			{
+				Job->Complete(LOCTEXT("ImportGridlyDataTableCancelled", "Cancelled"));
+			}
+			else
+			{
+				Job->Fail(FText::FromString(GridlyResult.Message));
+			}
+			ImportJobs.Remove(TableId);
 		});
 
 	Task->Activate();
 }
 
-bool CreateExportRequest(const UGridlyDataTable* GridlyDataTable,
+bool CreateExportRequest(const UGridlyDataTable* GridlyDataTable, const FGridlyDataTableExportSnapshot& ExportSnapshot,
 	const size_t StartIndex, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& ExportRequest)
 {
 	FString JsonString;
-	if (FGridlyExporter::ConvertToJson(GridlyDataTable, JsonString, StartIndex,
+	if (FGridlyExporter::ConvertToJson(ExportSnapshot, JsonString, StartIndex,
 		GetMutableDefault<UGridlyGameSettings>()->ExportMaxRecordsPerRequest))
 	{
 		const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 		const FString ApiKey = GameSettings->ExportApiKey;
 		const FString ViewId = GridlyDataTable->ViewId;
 
-		FStringFormatNamedArguments Args;
-		Args.Add(TEXT("ViewId"), *ViewId);
-		const FString Url = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/records"), Args);
+		const FString Url = FGridlyApi::GetViewUrl(ViewId, TEXT("records"));
 
-		const auto HttpRequest = FHttpModule::Get().CreateRequest();
-		HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-		HttpRequest->SetContentAsString(JsonString);
-		HttpRequest->SetVerb(TEXT("POST"));
-		HttpRequest->SetURL(Url);
+		const auto HttpRequest = FGridlyApi::CreateRequest(TEXT("POST"), Url, ApiKey);
+		FGridlyApi::SetContent(HttpRequest, JsonString);
 
 		ExportRequest = HttpRequest;
 
@@ -376,7 +398,8 @@ void FAssetTypeActions_GridlyDataTable::ExportToGridly(UGridlyDataTable* DataTab
 	size_t TotalRequests = 0;
 	size_t StartIndex = 0;
 	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
-	while (CreateExportRequest(GridlyDataTable, StartIndex, HttpRequest))
+	const FGridlyDataTableExportSnapshot ExportSnapshot(GridlyDataTable);
+	while (CreateExportRequest(GridlyDataTable, ExportSnapshot, StartIndex, HttpRequest))
 	{
 		HttpRequest->OnProcessRequestComplete().
 		             BindLambda([this, ExportDataTableToGridlySlowTask](FHttpRequestPtr HttpRequest,
@@ -391,7 +414,7 @@ void FAssetTypeActions_GridlyDataTable::ExportToGridly(UGridlyDataTable* DataTab
 					             TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> NextHttpRequest;
 					             if (this->ExportRequestQueue.Dequeue(NextHttpRequest))
 					             {
-						             NextHttpRequest->ProcessRequest();
+						             FGridlyApi::ProcessRequest(NextHttpRequest.ToSharedRef());
 					             }
 					             else
 					             {
@@ -401,7 +424,7 @@ void FAssetTypeActions_GridlyDataTable::ExportToGridly(UGridlyDataTable* DataTab
 				             else
 				             {
 					             ExportDataTableToGridlySlowTask.Reset();
-					             const FString Content = HttpResponse->GetContentAsString();
+					             const FString Content = FGridlyApi::GetContentAsString(HttpResponse);
 					             const FString ErrorReason =
 						             FString::Printf(TEXT("Error: %d, reason: %s"), HttpResponse->GetResponseCode(), *Content);
 					             UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorReason);
@@ -417,7 +440,7 @@ void FAssetTypeActions_GridlyDataTable::ExportToGridly(UGridlyDataTable* DataTab
 	{
 		ExportDataTableToGridlySlowTask->TotalAmountOfWork = static_cast<float>(TotalRequests);
 		ExportDataTableToGridlySlowTask->MakeDialog();
-		HttpRequest->ProcessRequest();
+		FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
 	}
 	else
 	{
@@ -444,6 +467,6 @@ void FAssetTypeActions_GridlyDataTable::AddToolbarButton(FToolBarBuilder& Builde
 		);
 }
 
-TMap<uint32, TSharedPtr<FScopedSlowTask, ESPMode::ThreadSafe>> FAssetTypeActions_GridlyDataTable::ImportSlowTasks;
+TMap<uint32, TSharedPtr<FGridlyBackgroundJob>> FAssetTypeActions_GridlyDataTable::ImportJobs;
 
 #undef LOCTEXT_NAMESPACE
@@ -5,6 +5,8 @@
 #include "GridlyDataTable.h"
 #include "Interfaces/IHttpRequest.h"
 
+class FGridlyBackgroundJob;
+
 
 
 class FAssetTypeActions_GridlyDataTable : public FAssetTypeActions_Base
@@ -31,5 +33,6 @@ private:
 	void AddToolbarButton(FToolBarBuilder& Builder);
 
 	TQueue<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> ExportRequestQueue;
-	static TMap<uint32, TSharedPtr<FScopedSlowTask, ESPMode::ThreadSafe>> ImportSlowTasks;
+	/** Imports in progress, keyed by the data table's unique ID */
+	static TMap<uint32, TSharedPtr<FGridlyBackgroundJob>> ImportJobs;
 };
@@ -0,0 +1,147 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyBackgroundJob.h"
+
+#include "GridlyEditor.h"
+#include "MessageLogInitializationOptions.h"
+#include "MessageLogModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Logging/MessageLog.h"
+#include "Modules/ModuleManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "Gridly"
+
+const FName FGridlyBackgroundJob::MessageLogName(TEXT("Gridly"));
+
+namespace GridlyBackgroundJob
+{
+	bool CanNotify()
+	{
+		return !IsRunningCommandlet() && FSlateApplication::IsInitialized();
+	}
+}
+
+void FGridlyBackgroundJob::RegisterMessageLog()
+{
+	FMessageLogInitializationOptions InitOptions;
+	InitOptions.bShowPages = true;
+	InitOptions.bAllowClear = true;
+
+	FMessageLogModule& MessageLogModule = FModuleManager::LoadModuleChecked<FMessageLogModule>("MessageLog");
+	MessageLogModule.RegisterLogListing(MessageLogName, LOCTEXT("GridlyMessageLogLabel", "Gridly"), InitOptions);
+}
+
+void FGridlyBackgroundJob::UnregisterMessageLog()
+{
+	if (FModuleManager::Get().IsModuleLoaded("MessageLog"))
+	{
+		FModuleManager::GetModuleChecked<FMessageLogModule>("MessageLog").UnregisterLogListing(MessageLogName);
+	}
+}
+
+FGridlyBackgroundJob::FGridlyBackgroundJob(const FText& InTitle, const FSimpleDelegate& OnCancel)
+	: Title(InTitle)
+{
+	UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *Title.ToString());
+
+	if (!GridlyBackgroundJob::CanNotify())
+	{
+		return;
+	}
+
+	// One page per job, so the log reads run by run
+	FMessageLog(MessageLogName).NewPage(Title);
+
+	FNotificationInfo Info(Title);
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.bUseSuccessFailIcons = true;
+	Info.ExpireDuration = 8.f;
+	Info.Hyperlink = FSimpleDelegate::CreateLambda([]()
+	{
+		FMessageLog(MessageLogName).Open();
+	});
+	Info.HyperlinkText = LOCTEXT("GridlyJobShowLog", "Show Log");
+
+	if (OnCancel.IsBound())
+	{
+		Info.ButtonDetails.Add(FNotificationButtonInfo(LOCTEXT("GridlyJobCancel", "Cancel"),
+			LOCTEXT("GridlyJobCancelTooltip", "Stops the Gridly requests in flight"), OnCancel, SNotificationItem::CS_Pending));
+	}
+
+	Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	if (const TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		Item->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+}
+
+FGridlyBackgroundJob::~FGridlyBackgroundJob()
+{
+	if (const TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		if (Item->GetCompletionState() == SNotificationItem::CS_Pending)
+		{
+			Item->SetCompletionState(SNotificationItem::CS_None);
+			Item->ExpireAndFadeout();
+		}
+	}
+}
+
+void FGridlyBackgroundJob::SetProgress(const FText& Progress)
+{
+	if (const TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		Item->SetSubText(Progress);
+	}
+}
+
+void FGridlyBackgroundJob::AddMessage(EMessageSeverity::Type Severity, const FText& Message)
+{
+	if (GridlyBackgroundJob::CanNotify())
+	{
+		FMessageLog(MessageLogName).Message(Severity, Message);
+	}
+}
+
+void FGridlyBackgroundJob::Complete(const FText& Summary)
+{
+	Finish(Summary, false);
+}
+
+void FGridlyBackgroundJob::Fail(const FText& Summary)
+{
+	Finish(Summary, true);
+}
+
+void FGridlyBackgroundJob::Finish(const FText& Summary, bool bFailed)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	if (bFailed)
+	{
+		UE_LOG(LogGridlyEditor, Error, TEXT("%s: %s"), *Title.ToString(), *Summary.ToString());
+	}
+	else
+	{
+		UE_LOG(LogGridlyEditor, Log, TEXT("%s: %s"), *Title.ToString(), *Summary.ToString());
+	}
+
+	AddMessage(bFailed ? EMessageSeverity::Error : EMessageSeverity::Info, Summary);
+
+	if (const TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		Item->SetSubText(Summary);
+		Item->SetCompletionState(bFailed ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Item->ExpireAndFadeout();
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
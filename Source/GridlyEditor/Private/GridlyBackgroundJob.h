@@ -0,0 +1,47 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/TokenizedMessage.h"
+
+class SNotificationItem;
+
+/**
+ * Progress toast for a Gridly operation that runs while the editor stays usable. While the job runs the toast shows a
+ * throbber and a cancel button, and its outcome goes to the Gridly message log instead of a modal dialog.
+ * Outside the editor, such as in commandlets, jobs only write to the output log.
+ */
+class FGridlyBackgroundJob
+{
+public:
+	static const FName MessageLogName;
+
+	static void RegisterMessageLog();
+	static void UnregisterMessageLog();
+
+	/** OnCancel, if bound, is run by the toast's cancel button */
+	FGridlyBackgroundJob(const FText& InTitle, const FSimpleDelegate& OnCancel);
+
+	/** Fades the toast out if the job never finished */
+	~FGridlyBackgroundJob();
+
+	/** Shown below the title while the job runs */
+	void SetProgress(const FText& Progress);
+
+	/** Adds a message to the job's page of the message log without ending the job */
+	void AddMessage(EMessageSeverity::Type Severity, const FText& Message);
+
+	/** End the job. Only the first call has an effect */
+	void Complete(const FText& Summary);
+	void Fail(const FText& Summary);
+
+	bool IsFinished() const { return bFinished; }
+
+private:
+	void Finish(const FText& Summary, bool bFailed);
+
+	FText Title;
+	TWeakPtr<SNotificationItem> Notification;
+	bool bFinished = false;
+};
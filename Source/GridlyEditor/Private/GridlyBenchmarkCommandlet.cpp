@@ -0,0 +1,586 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyBenchmarkCommandlet.h"
+
+#include "GridlyApi.h"
+#include "GridlyDataTable.h"
+#include "GridlyDataTableImporterJSON.h"
+#include "GridlyGameSettings.h"
+#include "GridlyLocalizationServiceProvider.h"
+#include "GridlyMockServer.h"
+#include "GridlyStats.h"
+#include "GridlyTableRow.h"
+#include "GridlyTableRowSegment.h"
+#include "GridlyTask_DownloadLocalizedTexts.h"
+#include "HttpManager.h"
+#include "HttpModule.h"
+#include "JsonObjectConverter.h"
+#include "LocalizationTargetTypes.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformFileManager.h"
+#include "Internationalization/PolyglotTextData.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGridlyBenchmarkCommandlet, Log, All);
+
+namespace GridlyBenchmark
+{
+	static const TCHAR* ViewId = TEXT("benchmark");
+	static const TCHAR* StringTablePath = TEXT("/Temp/GridlyBenchmark");
+
+	static const TCHAR* Cultures[] = {
+		TEXT("en-US"), TEXT("fr-FR"), TEXT("de-DE"), TEXT("es-ES"), TEXT("it-IT"), TEXT("ja-JP"), TEXT("ko-KR"), TEXT("zh-CN"),
+		TEXT("pt-BR"), TEXT("ru-RU"), TEXT("pl-PL"), TEXT("tr-TR"), TEXT("nl-NL"), TEXT("sv-SE"), TEXT("ar-SA"), TEXT("th-TH")
+	};
+
+	/** Data table records in the shape Gridly serves them, with cells for every FGridlyBenchmarkTableRow property */
+	FString MakeDataTableRecordsJson(const FGridlyMockServer& MockServer)
+	{
+		const int32 NumRecords = MockServer.GetSpec().NumRecords;
+
+		FString Json;
+		Json.Reserve(NumRecords * 320);
+		Json.AppendChar(TEXT('['));
+		for (int32 RecordIndex = 0; RecordIndex < NumRecords; RecordIndex++)
+		{
+			if (RecordIndex > 0)
+			{
+				Json.AppendChar(TEXT(','));
+			}
+			Json.Appendf(TEXT("{\"id\":\"%s\",\"path\":\"%s\",\"cells\":[")
+				TEXT("{\"columnId\":\"Text\",\"value\":\"%s\"},{\"columnId\":\"Description\",\"value\":\"%s\"},")
+				TEXT("{\"columnId\":\"Count\",\"value\":\"%d\"},{\"columnId\":\"Weight\",\"value\":\"%.3f\"}]}"),
+				*MockServer.GetRecordId(RecordIndex), *MockServer.GetNamespace(RecordIndex), *MockServer.GetText(RecordIndex, 0),
+				*MockServer.GetText(RecordIndex, 1), RecordIndex % 1000, RecordIndex * 0.25f);
+		}
+		Json.AppendChar(TEXT(']'));
+
+		return Json;
+	}
+
+	TArray<FPolyglotTextData> MakePolyglotTextDatas(const FGridlyMockServer& MockServer)
+	{
+		const FGridlyMockViewSpec& Spec = MockServer.GetSpec();
+
+		TArray<FPolyglotTextData> PolyglotTextDatas;
+		PolyglotTextDatas.Reserve(Spec.NumRecords);
+		for (int32 RecordIndex = 0; RecordIndex < Spec.NumRecords; RecordIndex++)
+		{
+			FPolyglotTextData& PolyglotTextData = PolyglotTextDatas.Emplace_GetRef(ELocalizedTextSourceCategory::Game,
+				MockServer.GetNamespace(RecordIndex), MockServer.GetRecordId(RecordIndex), MockServer.GetText(RecordIndex, 0),
+				Spec.Cultures[0]);
+			for (int32 CultureIndex = 1; CultureIndex < Spec.Cultures.Num(); CultureIndex++)
+			{
+				PolyglotTextData.AddLocalizedString(Spec.Cultures[CultureIndex], MockServer.GetText(RecordIndex, CultureIndex));
+			}
+		}
+
+		return PolyglotTextDatas;
+	}
+}
+
+/**
+*	UGridlyBenchmarkCommandlet
+*/
+int32 UGridlyBenchmarkCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	UCommandlet::ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const auto GetIntParam = [&ParamVals](const TCHAR* Name, int32 DefaultValue)
+	{
+		const FString* Value = ParamVals.Find(Name);
+		return Value ? FCString::Atoi(**Value) : DefaultValue;
+	};
+
+	FGridlyMockViewSpec Spec;
+	Spec.NumRecords = FMath::Max(1, GetIntParam(TEXT("Records"), 10000));
+	Spec.NumNamespaces = FMath::Max(1, GetIntParam(TEXT("Namespaces"), 20));
+	Spec.NumGridlyOnlyRecords = Spec.NumRecords / 20;
+
+	const int32 NumLanguages = FMath::Clamp(GetIntParam(TEXT("Languages"), 8), 1, static_cast<int32>(UE_ARRAY_COUNT(GridlyBenchmark::Cultures)));
+	for (int32 CultureIndex = 0; CultureIndex < NumLanguages; CultureIndex++)
+	{
+		Spec.Cultures.Add(GridlyBenchmark::Cultures[CultureIndex]);
+	}
+
+	const int32 PageSize = FMath::Clamp(GetIntParam(TEXT("PageSize"), 1000), 1, 1000);
+	const uint32 Port = static_cast<uint32>(GetIntParam(TEXT("Port"), 8787));
+	TimeoutSeconds = FMath::Max(1, GetIntParam(TEXT("Timeout"), 600));
+
+	TArray<FString> Benchmarks = {
+		TEXT("Download"), TEXT("Export"), TEXT("Sync"), TEXT("SourceChanges"), TEXT("DataTable"), TEXT("Lifetime")
+	};
+	if (const FString* OnlyParamVal = ParamVals.Find(TEXT("Only")))
+	{
+		OnlyParamVal->ParseIntoArray(Benchmarks, TEXT(","));
+	}
+
+	// Point the settings at the synthetic view, the project's own settings are put back at the end
+
+	UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
+	const TStrongObjectPtr<UGridlyGameSettings> SavedGameSettings(NewObject<UGridlyGameSettings>(GetTransientPackage()));
+
+	GameSettings->ImportApiKey = TEXT("benchmark");
+	GameSettings->ImportFromViewIds = { GridlyBenchmark::ViewId };
+	GameSettings->ImportMaxRecordsPerRequest = PageSize;
+	GameSettings->ExportApiKey = TEXT("benchmark");
+	GameSettings->ExportViewId = GridlyBenchmark::ViewId;
+	GameSettings->ExportMaxRecordsPerRequest = PageSize;
+	GameSettings->bUseCombinedNamespaceId = false;
+	GameSettings->NamespaceColumnId = TEXT("path");
+	GameSettings->bExportContext = false;
+	GameSettings->bExportMetadata = false;
+	GameSettings->bSyncRecords = false;
+	GameSettings->StringTableSavePath = GridlyBenchmark::StringTablePath;
+	GameSettings->bCompressTransfers = Switches.Contains(TEXT("Compress"));
+	GameSettings->bDownloadOnlyTextColumns = Switches.Contains(TEXT("OnlyTextColumns"));
+	GameSettings->bAdaptiveBatchSizes = Switches.Contains(TEXT("Adaptive"));
+	GameSettings->TargetRequestSizeKB = FMath::Max(1, GetIntParam(TEXT("TargetRequestKB"), GameSettings->TargetRequestSizeKB));
+	GameSettings->bCheckpointDownloads = Switches.Contains(TEXT("Checkpoint"));
+	GameSettings->DownloadMemoryBudgetMB = FMath::Max(0, GetIntParam(TEXT("MemoryBudgetMB"), 0));
+
+	// Map the cultures explicitly, so they import whichever cultures the project's targets have
+	GameSettings->bUseCustomCultureMapping = true;
+	for (const FString& Culture : Spec.Cultures)
+	{
+		GameSettings->CustomCultureMapping.Add(Culture, Culture.Replace(TEXT("-"), TEXT("")));
+	}
+
+	MockServer = MakeShared<FGridlyMockServer>(Spec);
+	if (MockServer->Start(Port))
+	{
+		FGridlyApi::SetBaseUrlOverride(MockServer->GetBaseUrl());
+		Provider = MakeShared<FGridlyLocalizationServiceProvider>();
+		FGridlyPerfCounters::Reset();
+
+		if (Benchmarks.Contains(TEXT("Download")))
+		{
+			RunBenchmark(TEXT("Download"), [this](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkDownload(Result);
+			});
+		}
+
+		if (Benchmarks.Contains(TEXT("Export")))
+		{
+			TArray<FPolyglotTextData> PolyglotTextDatas = GridlyBenchmark::MakePolyglotTextDatas(*MockServer);
+			RunBenchmark(TEXT("Export"), [this, &PolyglotTextDatas](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkExport(MoveTemp(PolyglotTextDatas), Result);
+			});
+		}
+
+		if (Benchmarks.Contains(TEXT("Sync")))
+		{
+			// The texts UE has, as an export would have left them
+			Provider->UERecords.Reset(Spec.NumRecords);
+			for (int32 RecordIndex = 0; RecordIndex < Spec.NumRecords; RecordIndex++)
+			{
+				Provider->UERecords.Emplace(Provider->SessionStrings.Intern(MockServer->GetRecordId(RecordIndex)),
+					Provider->SessionStrings.Intern(MockServer->GetNamespace(RecordIndex)));
+			}
+
+			RunBenchmark(TEXT("Sync"), [this](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkSync(Result);
+			});
+		}
+
+		if (Benchmarks.Contains(TEXT("SourceChanges")))
+		{
+			RunBenchmark(TEXT("SourceChanges"), [this, &Spec](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkSourceChanges(Spec.Cultures[0], Result);
+			});
+
+			// Packages under /Temp live in the project's Saved directory, not under Content
+			FString StringTableDirectory;
+			if (FPackageName::TryConvertLongPackageNameToFilename(FString(GridlyBenchmark::StringTablePath) / TEXT(""), StringTableDirectory))
+			{
+				IFileManager::Get().DeleteDirectory(*StringTableDirectory, false, true);
+			}
+		}
+
+		if (Benchmarks.Contains(TEXT("DataTable")))
+		{
+			const FString RecordsJson = GridlyBenchmark::MakeDataTableRecordsJson(*MockServer);
+
+			// The importer adds and removes rows through UGridlyDataTable
+			const TStrongObjectPtr<UGridlyDataTable> DataTable(NewObject<UGridlyDataTable>(GetTransientPackage()));
+			DataTable->RowStruct = FGridlyBenchmarkTableRow::StaticStruct();
+			DataTable->bIgnoreExtraFields = true;
+
+			RunBenchmark(TEXT("DataTable"), [this, &DataTable, &RecordsJson](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkDataTable(DataTable.Get(), RecordsJson, false, Result);
+			});
+
+			// Importing the same records again only compares them
+			RunBenchmark(TEXT("DataTableDiff"), [this, &DataTable, &RecordsJson](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkDataTable(DataTable.Get(), RecordsJson, true, Result);
+			});
+		}
+
+		// Guards against download tasks leaking again, the commandlet returns 1 if one was not released
+		if (Benchmarks.Contains(TEXT("Lifetime")))
+		{
+			const int32 NumImports = FMath::Max(1, GetIntParam(TEXT("Imports"), 100));
+			RunBenchmark(TEXT("Lifetime"), [this, NumImports](FGridlyBenchmarkResult& Result)
+			{
+				return BenchmarkLifetime(NumImports, Result);
+			});
+		}
+
+		FGridlyApi::SetBaseUrlOverride(FString());
+		MockServer->Stop();
+	}
+
+	for (TFieldIterator<FProperty> It(UGridlyGameSettings::StaticClass()); It; ++It)
+	{
+		It->CopyCompleteValue_InContainer(GameSettings, SavedGameSettings.Get());
+	}
+
+	if (Results.Num() == 0)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("No benchmark was run."));
+		return 1;
+	}
+
+	LogResults();
+	FGridlyPerfCounters::LogSummary();
+
+	if (const FString* ReportParamVal = ParamVals.Find(TEXT("Report")))
+	{
+		WriteReport(*ReportParamVal);
+	}
+
+	const bool bAllSucceeded = !Results.ContainsByPredicate([](const FGridlyBenchmarkResult& Result)
+	{
+		return !Result.bSucceeded;
+	});
+	return bAllSucceeded ? 0 : 1;
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkDownload(FGridlyBenchmarkResult& Result,
+	TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts>* OutTask)
+{
+	bool bDone = false;
+	bool bSucceeded = false;
+
+	UGridlyTask_DownloadLocalizedTexts* Task = UGridlyTask_DownloadLocalizedTexts::DownloadLocalizedTexts(nullptr);
+	Task->bThrottleRequests = false;
+	Task->OnRecordStoreSuccessDelegate.BindLambda([&](const FGridlyTextRecordStore& TextRecords)
+	{
+		Result.NumRecords = TextRecords.Num();
+		bSucceeded = Result.NumRecords == MockServer->GetSpec().NumRecords;
+		if (!bSucceeded)
+		{
+			UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Downloaded %lld of %d records"), Result.NumRecords,
+				MockServer->GetSpec().NumRecords);
+		}
+		bDone = true;
+	});
+	Task->OnFailDelegate.BindLambda([&](const TArray<FPolyglotTextData>& PolyglotTextDatas, const FGridlyResult& Error)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Download failed: %s"), *Error.Message);
+		bDone = true;
+	});
+	Task->Activate();
+
+	const bool bFinished = WaitUntil([&bDone]() { return bDone; });
+
+	Task->OnRecordStoreSuccessDelegate.Unbind();
+	Task->OnFailDelegate.Unbind();
+
+	if (OutTask)
+	{
+		*OutTask = Task;
+	}
+
+	return bFinished && bSucceeded;
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkLifetime(int32 NumImports, FGridlyBenchmarkResult& Result)
+{
+	TArray<TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts>> Tasks;
+	for (int32 ImportIndex = 0; ImportIndex < NumImports; ImportIndex++)
+	{
+		FGridlyBenchmarkResult ImportResult;
+		TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts> Task;
+		if (!BenchmarkDownload(ImportResult, &Task))
+		{
+			return false;
+		}
+
+		Result.NumRecords += ImportResult.NumRecords;
+		Tasks.Add(Task);
+
+		// Collect now and then, as the editor would between imports
+		if ((ImportIndex + 1) % 10 == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			SampleMemory();
+		}
+	}
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	const int32 NumAliveTasks = Tasks.FilterByPredicate([](const TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts>& Task)
+	{
+		return Task.IsValid();
+	}).Num();
+
+	if (NumAliveTasks > 0)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("%d of %d completed download tasks were not released"), NumAliveTasks, NumImports);
+		return false;
+	}
+
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("All %d completed download tasks were released"), NumImports);
+	return true;
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkExport(TArray<FPolyglotTextData>&& PolyglotTextDatas, FGridlyBenchmarkResult& Result)
+{
+	Result.NumRecords = PolyglotTextDatas.Num();
+
+	FHttpRequestCompleteDelegate ReqDelegate = Provider->CreateExportNativeCultureDelegate();
+	Provider->ExportPolyglotTextDatasToGridly(MoveTemp(PolyglotTextDatas), nullptr, ReqDelegate, FText::GetEmpty());
+
+	if (!WaitUntil([this]() { return !Provider->HasRequestsPending(); }))
+	{
+		return false;
+	}
+
+	// Every record is sent exactly once, in chunks of at most ExportMaxRecordsPerRequest. Adaptive chunks also stay within
+	// TargetRequestSizeKB, so they can only be more
+	const UGridlyGameSettings* GameSettings = GetDefault<UGridlyGameSettings>();
+	const int32 MaxRecordsPerRequest = FMath::Max(1, GameSettings->ExportMaxRecordsPerRequest);
+	const int32 MinChunks = FMath::DivideAndRoundUp(static_cast<int32>(Result.NumRecords), MaxRecordsPerRequest);
+	const int32 NumChunks = MockServer->GetNumPostRecordsRequests();
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("Exported %llu of %lld records in %d requests (%d at %d records per request)"),
+		Provider->GetNumExportedEntries(), Result.NumRecords, NumChunks, MinChunks, MaxRecordsPerRequest);
+
+	const bool bChunksValid = GameSettings->bAdaptiveBatchSizes ? NumChunks >= MinChunks : NumChunks == MinChunks;
+	return bChunksValid && Provider->GetNumExportedEntries() == static_cast<uint64>(Result.NumRecords);
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkSync(FGridlyBenchmarkResult& Result)
+{
+	Result.NumRecords = MockServer->GetSpec().NumRecords + MockServer->GetSpec().NumGridlyOnlyRecords;
+
+	Provider->GridlyRecords.Reset();
+	Provider->FetchGridlyCSV();
+
+	if (!WaitUntil([this]() { return !Provider->HasDeleteRequestsPending(); }))
+	{
+		return false;
+	}
+
+	// UE has every record of the view, so exactly the Gridly-only records are deleted
+	const int32 NumDeletedRecords = MockServer->GetNumDeletedRecords();
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("Deleted %d of %d Gridly-only records"), NumDeletedRecords,
+		MockServer->GetSpec().NumGridlyOnlyRecords);
+
+	return NumDeletedRecords == MockServer->GetSpec().NumGridlyOnlyRecords;
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkSourceChanges(const FString& NativeCulture, FGridlyBenchmarkResult& Result)
+{
+	Result.NumRecords = MockServer->GetSpec().NumRecords;
+
+	const TStrongObjectPtr<ULocalizationTarget> Target(NewObject<ULocalizationTarget>(GetTransientPackage()));
+	Target->Settings.Name = TEXT("GridlyBenchmark");
+
+	if (!Provider->DownloadSourceChangesFromGridlyInternal(Target.Get(), NativeCulture))
+	{
+		return false;
+	}
+
+	return WaitUntil([this]() { return !Provider->bSourceDownloadInProgress; }) && !Provider->HasSourceDownloadFailed()
+		&& Provider->TouchedStringTables.Num() > 0;
+}
+
+bool UGridlyBenchmarkCommandlet::BenchmarkDataTable(UGridlyDataTable* DataTable, const FString& RecordsJson, bool bAsDiff,
+	FGridlyBenchmarkResult& Result)
+{
+	// Same steps as UGridlyTask_ImportDataTableFromGridly, without the download
+	TArray<FGridlyTableRow> TableRows;
+	bool bParsed;
+	{
+		GRIDLY_PERF_SCOPE(DataTable, Parse);
+		bParsed = FJsonObjectConverter::JsonArrayStringToUStruct(RecordsJson, &TableRows, 0, 0);
+	}
+
+	if (!bParsed)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Unable to parse the data table records"));
+		return false;
+	}
+
+	GRIDLY_PERF_SCOPE(DataTable, Convert);
+	FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::DataTable, TableRows.Num());
+	Result.NumRecords = TableRows.Num();
+
+	FGridlyTableRowSegment TableRowSegment;
+	TableRowSegment.Reset();
+	TableRowSegment.AppendPage(MoveTemp(TableRows));
+
+	TArray<FString> Problems;
+	FGridlyDataTableImporterJSON Importer(*DataTable, TableRowSegment, Problems);
+
+	bool bImported;
+	if (bAsDiff)
+	{
+		FGridlyDataTableImportChanges Changes;
+		bImported = Importer.ReadTableAsDiff(Changes);
+
+		// The table already holds these records, so nothing may differ
+		if (Changes.HasChanges())
+		{
+			UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Importing unchanged records added %d, changed %d and removed %d rows"),
+				Changes.AddedRows.Num(), Changes.ChangedRows.Num(), Changes.RemovedRows.Num());
+			bImported = false;
+		}
+	}
+	else
+	{
+		bImported = Importer.ReadTable();
+	}
+
+	for (const FString& Problem : Problems)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Warning, TEXT("%s"), *Problem);
+	}
+
+	// The rows were moved into the segment, so they are counted from the result
+	return bImported && DataTable->GetRowMap().Num() == Result.NumRecords;
+}
+
+void UGridlyBenchmarkCommandlet::RunBenchmark(const FString& Name, TFunctionRef<bool(FGridlyBenchmarkResult&)> Benchmark)
+{
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("Running %s benchmark"), *Name);
+
+	// Start from what is still referenced, so the previous benchmark's garbage does not count
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const uint64 BaselineUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	PeakUsedPhysical = BaselineUsedPhysical;
+	MockServer->ResetCounters();
+
+	FGridlyBenchmarkResult Result;
+	Result.Name = Name;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Result.bSucceeded = Benchmark(Result);
+	Result.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	SampleMemory();
+	Result.PeakMemoryBytes = static_cast<int64>(PeakUsedPhysical - BaselineUsedPhysical);
+	Result.NumRequests = MockServer->GetNumRequests();
+	Result.BytesSent = MockServer->GetBytesReceived();
+	Result.BytesReceived = MockServer->GetBytesSent();
+
+	if (!Result.bSucceeded)
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("%s benchmark failed"), *Name);
+	}
+
+	Results.Add(MoveTemp(Result));
+}
+
+bool UGridlyBenchmarkCommandlet::WaitUntil(TFunctionRef<bool()> IsDone)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	double LastTime = StartTime;
+
+	while (!IsDone())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - StartTime > TimeoutSeconds)
+		{
+			UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Timed out after %.0f seconds"), TimeoutSeconds);
+			return false;
+		}
+
+		const float DeltaTime = static_cast<float>(Now - LastTime);
+		LastTime = Now;
+
+		// The mock server is ticked by the core ticker, the requests by the HTTP manager
+		FTSTicker::GetCoreTicker().Tick(DeltaTime);
+		FHttpModule::Get().GetHttpManager().Tick(DeltaTime);
+		SampleMemory();
+
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	return true;
+}
+
+void UGridlyBenchmarkCommandlet::SampleMemory()
+{
+	PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+}
+
+void UGridlyBenchmarkCommandlet::LogResults() const
+{
+	const FGridlyMockViewSpec& Spec = MockServer->GetSpec();
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("=== GRIDLY BENCHMARK: %d records, %d languages, %d namespaces ==="),
+		Spec.NumRecords, Spec.Cultures.Num(), Spec.NumNamespaces);
+
+	for (const FGridlyBenchmarkResult& Result : Results)
+	{
+		const double RecordsPerSecond = Result.Seconds > 0.0 ? Result.NumRecords / Result.Seconds : 0.0;
+		UE_LOG(LogGridlyBenchmarkCommandlet, Display,
+			TEXT("%s: %s, %.3f s, %lld records, %.0f records/s, %d requests, %.2f MB sent, %.2f MB received, %.2f MB peak memory"),
+			*Result.Name, Result.bSucceeded ? TEXT("OK") : TEXT("FAILED"), Result.Seconds, Result.NumRecords, RecordsPerSecond,
+			Result.NumRequests, Result.BytesSent / (1024.0 * 1024.0), Result.BytesReceived / (1024.0 * 1024.0),
+			Result.PeakMemoryBytes / (1024.0 * 1024.0));
+	}
+}
+
+bool UGridlyBenchmarkCommandlet::WriteReport(const FString& ReportPath) const
+{
+	const FGridlyMockViewSpec& Spec = MockServer->GetSpec();
+
+	const TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+	ReportObject->SetNumberField(TEXT("records"), Spec.NumRecords);
+	ReportObject->SetNumberField(TEXT("languages"), Spec.Cultures.Num());
+	ReportObject->SetNumberField(TEXT("namespaces"), Spec.NumNamespaces);
+
+	TArray<TSharedPtr<FJsonValue>> BenchmarkValues;
+	for (const FGridlyBenchmarkResult& Result : Results)
+	{
+		const TSharedRef<FJsonObject> BenchmarkObject = MakeShared<FJsonObject>();
+		BenchmarkObject->SetStringField(TEXT("name"), Result.Name);
+		BenchmarkObject->SetBoolField(TEXT("succeeded"), Result.bSucceeded);
+		BenchmarkObject->SetNumberField(TEXT("seconds"), Result.Seconds);
+		BenchmarkObject->SetNumberField(TEXT("records"), Result.NumRecords);
+		BenchmarkObject->SetNumberField(TEXT("recordsPerSecond"), Result.Seconds > 0.0 ? Result.NumRecords / Result.Seconds : 0.0);
+		BenchmarkObject->SetNumberField(TEXT("requests"), Result.NumRequests);
+		BenchmarkObject->SetNumberField(TEXT("bytesSent"), Result.BytesSent);
+		BenchmarkObject->SetNumberField(TEXT("bytesReceived"), Result.BytesReceived);
+		BenchmarkObject->SetNumberField(TEXT("peakMemoryBytes"), Result.PeakMemoryBytes);
+		BenchmarkValues.Add(MakeShared<FJsonValueObject>(BenchmarkObject));
+	}
+	ReportObject->SetArrayField(TEXT("benchmarks"), BenchmarkValues);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	if (!FJsonSerializer::Serialize(ReportObject, Writer) || !FFileHelper::SaveStringToFile(ReportString, *ReportPath))
+	{
+		UE_LOG(LogGridlyBenchmarkCommandlet, Error, TEXT("Failed to write benchmark report: %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogGridlyBenchmarkCommandlet, Display, TEXT("Benchmark report written to: %s"), *ReportPath);
+	return true;
+}
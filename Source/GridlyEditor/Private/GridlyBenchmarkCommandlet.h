@@ -0,0 +1,103 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Engine/DataTable.h"
+#include "GridlyBenchmarkCommandlet.generated.h"
+
+class FGridlyLocalizationServiceProvider;
+class FGridlyMockServer;
+class UGridlyDataTable;
+class UGridlyTask_DownloadLocalizedTexts;
+struct FPolyglotTextData;
+
+/** Row struct of the data table the benchmark imports into */
+USTRUCT()
+struct FGridlyBenchmarkTableRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Text;
+
+	UPROPERTY()
+	FString Description;
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	float Weight = 0.f;
+};
+
+struct FGridlyBenchmarkResult
+{
+	FString Name;
+	bool bSucceeded = false;
+	double Seconds = 0.0;
+	int64 NumRecords = 0;
+
+	// As seen by the mock server, so sent means sent by the plugin
+	int32 NumRequests = 0;
+	int64 BytesSent = 0;
+	int64 BytesReceived = 0;
+
+	/** Highest physical memory use while the benchmark ran, above what was in use when it started */
+	int64 PeakMemoryBytes = 0;
+};
+
+/**
+ * GridlyBenchmarkCommandlet: Runs the plugin's import, export, sync, source change and data table paths against a local
+ * mock of the Gridly API serving a synthetic view, and reports throughput and peak memory of each. Each benchmark also
+ * checks its outcome, and the commandlet returns 1 if any failed, so it can gate CI.
+ *
+ * -Records=10000 -Languages=8 -Namespaces=20 -PageSize=1000 -Port=8787 -Timeout=600 -MemoryBudgetMB=0
+ * -Only=Download,Export,Sync,SourceChanges,DataTable,Lifetime -Report=<path of a JSON report>
+ * -Imports=100 downloads for Lifetime, which checks that repeated downloads release their tasks
+ * -Compress to send and receive gzip compressed bodies, -OnlyTextColumns to download only the columns imports read,
+ * -Adaptive to size pages and chunks from earlier requests, -TargetRequestKB=<TargetRequestSizeKB for adaptive chunks>,
+ * -Checkpoint to save downloaded pages as they arrive
+ */
+UCLASS()
+class UGridlyBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGridlyBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+		: Super(ObjectInitializer)
+	{}
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	bool BenchmarkDownload(FGridlyBenchmarkResult& Result, TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts>* OutTask = nullptr);
+	bool BenchmarkExport(TArray<FPolyglotTextData>&& PolyglotTextDatas, FGridlyBenchmarkResult& Result);
+	bool BenchmarkSync(FGridlyBenchmarkResult& Result);
+	bool BenchmarkSourceChanges(const FString& NativeCulture, FGridlyBenchmarkResult& Result);
+	bool BenchmarkDataTable(UGridlyDataTable* DataTable, const FString& RecordsJson, bool bAsDiff, FGridlyBenchmarkResult& Result);
+
+	/** Downloads the view NumImports times and fails if any completed task is still alive after garbage collection */
+	bool BenchmarkLifetime(int32 NumImports, FGridlyBenchmarkResult& Result);
+
+	/** Runs one benchmark and records its time, traffic and memory */
+	void RunBenchmark(const FString& Name, TFunctionRef<bool(FGridlyBenchmarkResult&)> Benchmark);
+
+	/** Ticks HTTP requests and the mock server until IsDone returns true, returns false on timeout */
+	bool WaitUntil(TFunctionRef<bool()> IsDone);
+	void SampleMemory();
+
+	void LogResults() const;
+	bool WriteReport(const FString& ReportPath) const;
+
+	TSharedPtr<FGridlyMockServer> MockServer;
+	TSharedPtr<FGridlyLocalizationServiceProvider> Provider;
+
+	TArray<FGridlyBenchmarkResult> Results;
+	uint64 PeakUsedPhysical = 0;
+	double TimeoutSeconds = 600.0;
+};
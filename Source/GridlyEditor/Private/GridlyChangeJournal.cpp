@@ -0,0 +1,318 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyChangeJournal.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "Internationalization/StringTable.h"
+#include "LocalizationTargetTypes.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Modules/ModuleManager.h"
+
+namespace GridlyChangeJournal
+{
+	void UpdateHash(FMD5& Md5, const FString& String)
+	{
+		const FTCHARToUTF8 Utf8(*String);
+		Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	bool MatchesAnyWildcard(const FString& Path, const TArray<FString>& Wildcards)
+	{
+		for (const FString& Wildcard : Wildcards)
+		{
+			if (Path.MatchesWildcard(Wildcard))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Directory part of a pattern such as "Content/UI/*", relative to the gather root */
+	FString GetPatternBaseDirectory(const FString& Pattern)
+	{
+		int32 WildcardIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < Pattern.Len(); ++Index)
+		{
+			if (Pattern[Index] == TEXT('*') || Pattern[Index] == TEXT('?'))
+			{
+				WildcardIndex = Index;
+				break;
+			}
+		}
+
+		if (WildcardIndex == INDEX_NONE)
+		{
+			return Pattern;
+		}
+
+		const FString Prefix = Pattern.Left(WildcardIndex);
+		int32 SlashIndex = INDEX_NONE;
+		return Prefix.FindLastChar(TEXT('/'), SlashIndex) ? Prefix.Left(SlashIndex) : FString();
+	}
+
+	/**
+	 * Collects "relative path|size|timestamp" lines for matching files below Directory. Matching files in ContentHashedFiles
+	 * go to OutContentHashedFiles instead, keyed by relative path, or are skipped without it.
+	 */
+	void CollectFiles(const FString& Root, const FString& Directory, const TArray<FString>& IncludeWildcards, const TArray<FString>& ExcludeWildcards,
+		const TArray<FString>& ExtensionWildcards, const TSet<FString>& ContentHashedFiles, TSet<FString>& OutLines,
+		TMap<FString, FFileStatData>* OutContentHashedFiles = nullptr)
+	{
+		const FString AbsoluteDirectory = FPaths::ConvertRelativePathToFull(Root, Directory);
+		IFileManager::Get().IterateDirectoryStatRecursively(*AbsoluteDirectory,
+			[&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+			{
+				if (StatData.bIsDirectory)
+				{
+					return true;
+				}
+
+				const FString Filename(FilenameOrDirectory);
+				FString RelativePath = Filename;
+				FPaths::MakePathRelativeTo(RelativePath, *Root);
+
+				if (!MatchesAnyWildcard(FPaths::GetCleanFilename(Filename), ExtensionWildcards)
+					|| (IncludeWildcards.Num() > 0 && !MatchesAnyWildcard(RelativePath, IncludeWildcards))
+					|| MatchesAnyWildcard(RelativePath, ExcludeWildcards))
+				{
+					return true;
+				}
+
+				if (ContentHashedFiles.Contains(Filename))
+				{
+					if (OutContentHashedFiles)
+					{
+						OutContentHashedFiles->Add(RelativePath, StatData);
+					}
+					return true;
+				}
+
+				OutLines.Add(FString::Printf(TEXT("%s|%lld|%lld"), *RelativePath, StatData.FileSize, StatData.ModificationTime.GetTicks()));
+				return true;
+			});
+	}
+}
+
+FString FGridlyChangeJournal::ComputeGatherInputsHash(const ULocalizationTarget* LocalizationTarget, const FString& GatherScriptPath)
+{
+	using namespace GridlyChangeJournal;
+
+	FMD5 Md5;
+
+	// Generated gather config: any change to what or how the target gathers
+	FString GatherScript;
+	FFileHelper::LoadFileToString(GatherScript, *GatherScriptPath);
+	UpdateHash(Md5, GatherScript);
+
+	const FString Root = FPaths::ConvertRelativePathToFull(LocalizationTarget->IsMemberOfEngineTargetSet() ? FPaths::EngineDir() : FPaths::ProjectDir());
+
+	// Files written by the localization tools themselves must not invalidate the journal
+	TArray<FString> CommonExcludes = {
+		TEXT("Config/Localization/*"),
+		TEXT("Saved/*"),
+		TEXT("Intermediate/*")
+	};
+
+	// String table assets are the inputs Gridly changes, they are hashed by content as saving them touches the timestamp
+	TSet<FString> ContentHashedFiles;
+	{
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UStringTable::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+
+		TArray<FAssetData> AssetList;
+		AssetRegistryModule.Get().GetAssets(Filter, AssetList);
+		for (const FAssetData& AssetData : AssetList)
+		{
+			FString Filename;
+			if (FPackageName::TryConvertLongPackageNameToFilename(AssetData.PackageName.ToString(), Filename, FPackageName::GetAssetPackageExtension()))
+			{
+				ContentHashedFiles.Add(FPaths::ConvertRelativePathToFull(Filename));
+			}
+		}
+	}
+
+	TSet<FString> FileLines;
+	TMap<FString, FFileStatData> StringTableFiles;
+	const FLocalizationTargetSettings& Settings = LocalizationTarget->Settings;
+
+	if (Settings.GatherFromTextFiles.IsEnabled)
+	{
+		TArray<FString> ExcludeWildcards = CommonExcludes;
+		for (const FGatherTextExcludePath& ExcludePath : Settings.GatherFromTextFiles.ExcludePathWildcards)
+		{
+			ExcludeWildcards.Add(ExcludePath.Pattern);
+		}
+
+		TArray<FString> ExtensionWildcards;
+		for (const FGatherTextFileExtension& FileExtension : Settings.GatherFromTextFiles.FileExtensions)
+		{
+			ExtensionWildcards.Add(FileExtension.Pattern);
+		}
+
+		for (const FGatherTextSearchDirectory& SearchDirectory : Settings.GatherFromTextFiles.SearchDirectories)
+		{
+			CollectFiles(Root, SearchDirectory.Path, TArray<FString>(), ExcludeWildcards, ExtensionWildcards, ContentHashedFiles, FileLines);
+		}
+	}
+
+	if (Settings.GatherFromPackages.IsEnabled)
+	{
+		TArray<FString> ExcludeWildcards = CommonExcludes;
+		for (const FGatherTextExcludePath& ExcludePath : Settings.GatherFromPackages.ExcludePathWildcards)
+		{
+			ExcludeWildcards.Add(ExcludePath.Pattern);
+		}
+
+		TArray<FString> ExtensionWildcards;
+		for (const FGatherTextFileExtension& FileExtension : Settings.GatherFromPackages.FileExtensions)
+		{
+			ExtensionWildcards.Add(FileExtension.Pattern);
+		}
+
+		for (const FGatherTextIncludePath& IncludePath : Settings.GatherFromPackages.IncludePathWildcards)
+		{
+			CollectFiles(Root, GetPatternBaseDirectory(IncludePath.Pattern), { IncludePath.Pattern }, ExcludeWildcards, ExtensionWildcards,
+				ContentHashedFiles, FileLines, &StringTableFiles);
+		}
+	}
+
+	// Metadata is gathered from the reflected headers below the include paths
+	if (Settings.GatherFromMetaData.IsEnabled)
+	{
+		UpdateHash(Md5, FString::Printf(TEXT("MetaData|%d"), Settings.GatherFromMetaData.ShouldGatherFromEditorOnlyData ? 1 : 0));
+		for (const FMetaDataKeyGatherSpecification& KeySpecification : Settings.GatherFromMetaData.KeySpecifications)
+		{
+			UpdateHash(Md5, FString::Printf(TEXT("%s|%s|%s"), *KeySpecification.MetaDataKey.Name, *KeySpecification.TextNamespace,
+				*KeySpecification.TextKeyPattern.Pattern));
+		}
+
+		TArray<FString> ExcludeWildcards = CommonExcludes;
+		for (const FGatherTextExcludePath& ExcludePath : Settings.GatherFromMetaData.ExcludePathWildcards)
+		{
+			UpdateHash(Md5, ExcludePath.Pattern);
+			ExcludeWildcards.Add(ExcludePath.Pattern);
+		}
+
+		for (const FGatherTextIncludePath& IncludePath : Settings.GatherFromMetaData.IncludePathWildcards)
+		{
+			UpdateHash(Md5, IncludePath.Pattern);
+			CollectFiles(Root, GetPatternBaseDirectory(IncludePath.Pattern), { IncludePath.Pattern }, ExcludeWildcards, { TEXT("*.h") },
+				ContentHashedFiles, FileLines);
+		}
+	}
+
+	// Only string tables the target gathers are hashed, and only those whose size or timestamp changed are read again
+	TArray<FString> StringTableLines;
+	{
+		const FString JournalPath = GetJournalPath();
+		FConfigFile Journal;
+		Journal.Read(JournalPath);
+
+		bool bJournalChanged = false;
+		for (const TPair<FString, FFileStatData>& StringTableFile : StringTableFiles)
+		{
+			const FString Stat = FString::Printf(TEXT("%lld|%lld"), StringTableFile.Value.FileSize, StringTableFile.Value.ModificationTime.GetTicks());
+
+			FString Recorded;
+			FString RecordedStat;
+			FString ContentHash;
+			if (!Journal.GetString(TEXT("StringTableHashes"), *StringTableFile.Key, Recorded) || !Recorded.Split(TEXT("#"), &RecordedStat, &ContentHash)
+				|| RecordedStat != Stat)
+			{
+				ContentHash = LexToString(FMD5Hash::HashFile(*FPaths::ConvertRelativePathToFull(Root, StringTableFile.Key)));
+				Journal.SetString(TEXT("StringTableHashes"), *StringTableFile.Key, *(Stat + TEXT("#") + ContentHash));
+				bJournalChanged = true;
+			}
+
+			StringTableLines.Add(FString::Printf(TEXT("%s|%s"), *StringTableFile.Key, *ContentHash));
+		}
+
+		if (bJournalChanged)
+		{
+			Journal.Write(JournalPath);
+		}
+	}
+
+	// Directory iteration order is not stable
+	TArray<FString> SortedLines = FileLines.Array();
+	SortedLines.Sort();
+	StringTableLines.Sort();
+
+	for (const FString& Line : StringTableLines)
+	{
+		UpdateHash(Md5, Line);
+	}
+	for (const FString& Line : SortedLines)
+	{
+		UpdateHash(Md5, Line);
+	}
+
+	uint8 Digest[16];
+	Md5.Final(Digest);
+	return BytesToHex(Digest, UE_ARRAY_COUNT(Digest));
+}
+
+FString FGridlyChangeJournal::GetRecordedHash(const FString& Section, const FString& Key)
+{
+	FConfigFile Journal;
+	Journal.Read(GetJournalPath());
+
+	FString Hash;
+	Journal.GetString(*Section, *Key, Hash);
+	return Hash;
+}
+
+void FGridlyChangeJournal::RecordHash(const FString& Section, const FString& Key, const FString& Hash)
+{
+	const FString JournalPath = GetJournalPath();
+
+	FConfigFile Journal;
+	Journal.Read(JournalPath);
+	Journal.SetString(*Section, *Key, *Hash);
+	Journal.Write(JournalPath);
+}
+
+TArray<FString> FGridlyChangeJournal::GetChangedImportCultures(const ULocalizationTarget* LocalizationTarget, const TMap<FString, FString>& CultureHashes)
+{
+	FConfigFile Journal;
+	Journal.Read(GetJournalPath());
+
+	TArray<FString> ChangedCultures;
+	for (const TPair<FString, FString>& CultureHash : CultureHashes)
+	{
+		FString RecordedHash;
+		Journal.GetString(TEXT("Import"), *(LocalizationTarget->Settings.Name / CultureHash.Key), RecordedHash);
+
+		if (CultureHash.Value.IsEmpty() || RecordedHash != CultureHash.Value)
+		{
+			ChangedCultures.Add(CultureHash.Key);
+		}
+	}
+	return ChangedCultures;
+}
+
+void FGridlyChangeJournal::RecordImportedCultures(const ULocalizationTarget* LocalizationTarget, const TMap<FString, FString>& CultureHashes)
+{
+	const FString JournalPath = GetJournalPath();
+
+	FConfigFile Journal;
+	Journal.Read(JournalPath);
+	for (const TPair<FString, FString>& CultureHash : CultureHashes)
+	{
+		Journal.SetString(TEXT("Import"), *(LocalizationTarget->Settings.Name / CultureHash.Key), *CultureHash.Value);
+	}
+	Journal.Write(JournalPath);
+}
+
+FString FGridlyChangeJournal::GetJournalPath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Gridly") / TEXT("ChangeJournal.ini");
+}
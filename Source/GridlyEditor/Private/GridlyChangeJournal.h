@@ -0,0 +1,44 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ULocalizationTarget;
+
+/**
+ * Fingerprints of localization inputs, recorded after each successful run so that work whose inputs did not change
+ * can be skipped next time. Stored in Saved/Gridly/ChangeJournal.ini.
+ */
+class FGridlyChangeJournal
+{
+public:
+	/**
+	 * Computes a fingerprint of everything a Gather Text run for the target reads, including metadata gathering settings and headers
+	 * String table assets under the target's package paths are hashed by content, which is cached in the journal by size and
+	 * timestamp, other gathered files by size and timestamp
+	 * @param LocalizationTarget The target to fingerprint
+	 * @param GatherScriptPath The generated gather config, hashed by content
+	 * @return Hex digest of the gather inputs
+	 */
+	static FString ComputeGatherInputsHash(const ULocalizationTarget* LocalizationTarget, const FString& GatherScriptPath);
+
+	/** Returns the hash recorded for Section/Key, or an empty string */
+	static FString GetRecordedHash(const FString& Section, const FString& Key);
+
+	/** Records the hash for Section/Key and writes the journal to disk */
+	static void RecordHash(const FString& Section, const FString& Key, const FString& Hash);
+
+	/**
+	 * Compares downloaded .po content with the content of the last successful import of the target
+	 * @param LocalizationTarget The target the .po files were downloaded for
+	 * @param CultureHashes Content hash of each downloaded culture, as computed by FGridlyLocalizedTextConverter::WritePoFile
+	 * @return The cultures whose content changed or was never imported
+	 */
+	static TArray<FString> GetChangedImportCultures(const ULocalizationTarget* LocalizationTarget, const TMap<FString, FString>& CultureHashes);
+
+	/** Records the content hashes of cultures whose import succeeded, with a single write of the journal */
+	static void RecordImportedCultures(const ULocalizationTarget* LocalizationTarget, const TMap<FString, FString>& CultureHashes);
+
+	static FString GetJournalPath();
+};
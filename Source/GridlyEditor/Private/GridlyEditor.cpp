@@ -2,6 +2,7 @@
 
 #include "GridlyEditor.h"
 
+#include "GridlyBackgroundJob.h"
 #include "GridlyCommands.h"
 #include "GridlyLocalizationServiceProvider.h"
 #include "GridlyStyle.h"
@@ -39,6 +40,9 @@ void FGridlyEditorModule::StartupModule()
 
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FGridlyEditorModule::RegisterMenus));
 
+	// Results of imports and exports running in the background
+	FGridlyBackgroundJob::RegisterMessageLog();
+
 	// Asset types
 	IAssetTools& AssetTools = FModuleManager::GetModuleChecked<FAssetToolsModule>("AssetTools").Get();
 	AssetTools.RegisterAssetTypeActions(MakeShareable(new FAssetTypeActions_GridlyDataTable()));
@@ -64,6 +68,7 @@ void FGridlyEditorModule::ShutdownModule()
 	UToolMenus::UnregisterOwner(this);
 	FGridlyStyle::Shutdown();
 	FGridlyCommands::Unregister();
+	FGridlyBackgroundJob::UnregisterMessageLog();
 
 	IModularFeatures::Get().UnregisterModularFeature("LocalizationService", &GridlyLocalizationServiceProvider);
 }
@@ -158,7 +158,7 @@ bool FGridlyExporter::ConvertToJson(const TArray<FPolyglotTextData>& PolyglotTex
 		Rows.Add(MakeShareable(new FJsonValueObject(RowJsonObject)));
 	}
 
-	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonStringWriter<>::Create(&OutJsonString);
+	const auto JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonString);
 	if (FJsonSerializer::Serialize(Rows, JsonWriter))
 	{
 		return true;
@@ -167,126 +167,137 @@ bool FGridlyExporter::ConvertToJson(const TArray<FPolyglotTextData>& PolyglotTex
 	return false;
 }
 
+FGridlyDataTableExportSnapshot::FGridlyDataTableExportSnapshot(const UGridlyDataTable* GridlyDataTable)
+{
+	if (!GridlyDataTable->RowStruct)
+	{
+		return;
+	}
+
+	RowStruct = GridlyDataTable->GetRowStruct();
+
+	const TMap<FName, uint8*>& RowMap = GridlyDataTable->GetRowMap();
+	Rows.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		Rows.Emplace(Row.Key, Row.Value);
+	}
+
+	for (TFieldIterator<const FProperty> It(RowStruct); It; ++It)
+	{
+		const FProperty* BaseProp = *It;
+		check(BaseProp);
+
+		const FString Identifier = DataTableUtils::GetPropertyExportName(BaseProp, EDataTableExportFlags::None);
+
+		// The _path property is sent as the record path rather than as a cell
+		if (Identifier == "_path")
+		{
+			PathProperty = BaseProp;
+			continue;
+		}
+
+		if (BaseProp->ArrayDim == 1)
+		{
+			Columns.Add({BaseProp, Identifier});
+		}
+	}
+}
+
 bool FGridlyExporter::ConvertToJson(const UGridlyDataTable* GridlyDataTable, FString& OutJsonString, size_t StartIndex,
 	size_t MaxSize)
 {
-	UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
-	const TArray<FString> TargetCultures = FGridlyCultureConverter::GetTargetCultures();
+	return ConvertToJson(FGridlyDataTableExportSnapshot(GridlyDataTable), OutJsonString, StartIndex, MaxSize);
+}
 
-	if (!GridlyDataTable->RowStruct)
+bool FGridlyExporter::ConvertToJson(const FGridlyDataTableExportSnapshot& Snapshot, FString& OutJsonString, size_t StartIndex,
+	size_t MaxSize)
+{
+	if (!Snapshot.IsValid())
 	{
 		return false;
 	}
 
-	FString KeyField = GridlyDataTableJSONUtils::GetKeyFieldName(*GridlyDataTable);
-
-	auto JsonWriter = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutJsonString);
+	auto JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonString);
 
 	JsonWriter->WriteArrayStart();
 
-	TArray<FName> Keys;
-	const TMap<FName, uint8*>& RowMap = GridlyDataTable->GetRowMap();
-	RowMap.GenerateKeyArray(Keys);
-
-	if (StartIndex < Keys.Num())
+	if (StartIndex < Snapshot.Rows.Num())
 	{
-		const size_t EndIndex = FMath::Min(StartIndex + MaxSize, static_cast<size_t>(Keys.Num()));
+		const EDataTableExportFlags DTExportFlags = EDataTableExportFlags::None;
+
+		const size_t EndIndex = FMath::Min(StartIndex + MaxSize, static_cast<size_t>(Snapshot.Rows.Num()));
 		for (size_t i = StartIndex; i < EndIndex; i++)
 		{
-			const FName RowName = Keys[i];
-			uint8* RowData = RowMap[RowName];
+			const FName RowName = Snapshot.Rows[i].Key;
+			uint8* RowData = const_cast<uint8*>(Snapshot.Rows[i].Value);
 
 			JsonWriter->WriteObjectStart();
 			{
 				// RowName
 				JsonWriter->WriteValue("id", RowName.ToString());
 
-				// Now handle the _path field
-				FString PathValue;
-				bool bPathFound = false;
-
 				// Now the values
 				JsonWriter->WriteArrayStart("cells");
 
-				for (TFieldIterator<const FProperty> It(GridlyDataTable->GetRowStruct()); It; ++It)
+				for (const FGridlyDataTableExportSnapshot::FColumn& Column : Snapshot.Columns)
 				{
-					const FProperty* BaseProp = *It;
-					check(BaseProp);
+					const FProperty* BaseProp = Column.Property;
+					const void* Data = BaseProp->ContainerPtrToValuePtr<void>(RowData, 0);
 
-					const EDataTableExportFlags DTExportFlags = EDataTableExportFlags::None;
+					JsonWriter->WriteObjectStart();
 
-					const FString Identifier = DataTableUtils::GetPropertyExportName(BaseProp, DTExportFlags);
-					const void* Data = BaseProp->ContainerPtrToValuePtr<void>(RowData, 0);
+					JsonWriter->WriteValue("columnId", Column.ExportName);
 
-					// Check if the property is _path and handle it separately
-					if (Identifier == "_path")
+					if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(BaseProp))
 					{
-						PathValue = DataTableUtils::GetPropertyValueAsString(BaseProp, static_cast<uint8*>(RowData), DTExportFlags);
-						bPathFound = true;
-						continue;  // Skip adding _path to the cells array
+						const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(EnumProp, RowData, DTExportFlags);
+						JsonWriter->WriteValue("value", PropertyValue);
 					}
-
-					if (BaseProp->ArrayDim == 1)
+					else if (const FNumericProperty* NumProp = CastField<const FNumericProperty>(BaseProp))
 					{
-						JsonWriter->WriteObjectStart();
-
-						const FString ExportId = DataTableUtils::GetPropertyExportName(BaseProp, DTExportFlags);
-						JsonWriter->WriteValue("columnId", ExportId);
-
-						if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(BaseProp))
+						if (NumProp->IsEnum())
 						{
-							const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(EnumProp,
-								static_cast<uint8*>(RowData), DTExportFlags);
+							const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(BaseProp, RowData, DTExportFlags);
 							JsonWriter->WriteValue("value", PropertyValue);
 						}
-						else if (const FNumericProperty* NumProp = CastField<const FNumericProperty>(BaseProp))
+						else if (NumProp->IsInteger())
 						{
-							if (NumProp->IsEnum())
-							{
-								const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(BaseProp,
-									static_cast<uint8*>(RowData), DTExportFlags);
-								JsonWriter->WriteValue("value", PropertyValue);
-							}
-							else if (NumProp->IsInteger())
-							{
-								const int64 PropertyValue = NumProp->GetSignedIntPropertyValue(Data);
-								JsonWriter->WriteValue("value", PropertyValue);
-							}
-							else
-							{
-								const double PropertyValue = NumProp->GetFloatingPointPropertyValue(Data);
-								JsonWriter->WriteValue("value", PropertyValue);
-							}
-						}
-						else if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(BaseProp))
-						{
-							const bool PropertyValue = BoolProp->GetPropertyValue(Data);
+							const int64 PropertyValue = NumProp->GetSignedIntPropertyValue(Data);
 							JsonWriter->WriteValue("value", PropertyValue);
 						}
 						else
 						{
-							const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(BaseProp,
-								static_cast<uint8*>(RowData), DTExportFlags);
+							const double PropertyValue = NumProp->GetFloatingPointPropertyValue(Data);
 							JsonWriter->WriteValue("value", PropertyValue);
 						}
-
-						JsonWriter->WriteObjectEnd();
 					}
+					else if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(BaseProp))
+					{
+						const bool PropertyValue = BoolProp->GetPropertyValue(Data);
+						JsonWriter->WriteValue("value", PropertyValue);
+					}
+					else
+					{
+						const FString PropertyValue = DataTableUtils::GetPropertyValueAsString(BaseProp, RowData, DTExportFlags);
+						JsonWriter->WriteValue("value", PropertyValue);
+					}
+
+					JsonWriter->WriteObjectEnd();
 				}
 
 				JsonWriter->WriteArrayEnd();
-				
-				// Now add the path if it was found
-				if (bPathFound)
+
+				// Now add the path if the row struct has one
+				if (Snapshot.PathProperty)
 				{
-					JsonWriter->WriteValue("path", *PathValue);  // Explicitly convert FString to TCHAR*
+					JsonWriter->WriteValue("path",
+						DataTableUtils::GetPropertyValueAsString(Snapshot.PathProperty, RowData, DTExportFlags));
 				}
 				else
 				{
-					JsonWriter->WriteValue("path", TEXT(""));  // Correctly pass an empty TCHAR* string
+					JsonWriter->WriteValue("path", TEXT(""));
 				}
-
-				
 			}
 			JsonWriter->WriteObjectEnd();
 		}
@@ -301,4 +312,3 @@ bool FGridlyExporter::ConvertToJson(const UGridlyDataTable* GridlyDataTable, FSt
 
 	return false;
 }
-
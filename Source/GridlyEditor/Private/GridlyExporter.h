@@ -6,10 +6,31 @@
 
 class FLocTextHelper;
 
+/** Rows and exported columns of a data table, captured once and shared by every export chunk */
+struct FGridlyDataTableExportSnapshot
+{
+	struct FColumn
+	{
+		const FProperty* Property = nullptr;
+		FString ExportName;
+	};
+
+	explicit FGridlyDataTableExportSnapshot(const UGridlyDataTable* GridlyDataTable);
+
+	bool IsValid() const { return RowStruct != nullptr; }
+
+	const UScriptStruct* RowStruct = nullptr;
+	TArray<TPair<FName, const uint8*>> Rows;
+	TArray<FColumn> Columns;
+	const FProperty* PathProperty = nullptr;
+};
+
 class FGridlyExporter
 {
 public:
 	static bool ConvertToJson(const TArray<FPolyglotTextData>& PolyglotTextDatas, bool bIncludeTargetTranslations,
 		const TSharedPtr<FLocTextHelper>& LocTextHelperPtr, FString& OutJsonString);
 	static bool ConvertToJson(const UGridlyDataTable* GridlyDataTable, FString& OutJsonString, size_t StartIndex, size_t MaxSize);
+	static bool ConvertToJson(const FGridlyDataTableExportSnapshot& Snapshot, FString& OutJsonString, size_t StartIndex,
+		size_t MaxSize);
 };
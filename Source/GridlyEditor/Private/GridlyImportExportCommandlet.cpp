@@ -2,6 +2,8 @@
 
 #include "GridlyImportExportCommandlet.h"
 #include "GridlyLocalizationServiceProvider.h"
+#include "GridlyChangeJournal.h"
+#include "GridlyStats.h"
 #include "Modules/ModuleManager.h"
 #include "ILocalizationServiceModule.h"
 #include "LocalizationModule.h"
@@ -9,16 +11,14 @@
 #include "LocalizationTargetTypes.h"
 #include "HttpModule.h"
 #include "HttpManager.h"
+#include "HAL/FileManager.h"
+#include "Containers/Ticker.h"
 #include "LocalizationConfigurationScript.h"
 #include "LocalizationCommandletExecution.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
-#include "Misc/FileHelper.h"
-#include "HAL/PlatformFilemanager.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
+#include "Internationalization/StringTable.h"
 
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Class.h"
@@ -35,6 +35,8 @@ int32 UGridlyImportExportCommandlet::Main(const FString& Params)
 {
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== GridlyImportExportCommandlet Main() called ==="));
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("GridlyImportExportCommandlet started with params: %s"), *Params);
+
+	FGridlyPerfCounters::Reset();
 	
 	TArray<FString> Tokens;
 	TArray<FString> Switches;
@@ -71,7 +73,7 @@ int32 UGridlyImportExportCommandlet::Main(const FString& Params)
 
 	const bool bCanUseGridly = LocServProvider.IsEnabled() && LocServProvider.IsAvailable() && LocServProvider.GetName().ToString() == TEXT("Gridly");
 
-	FGridlyLocalizationServiceProvider* GridlyProvider = bCanUseGridly ? static_cast<FGridlyLocalizationServiceProvider*>(&LocServProvider) : nullptr;
+	GridlyProvider = bCanUseGridly ? static_cast<FGridlyLocalizationServiceProvider*>(&LocServProvider) : nullptr;
 	if (!GridlyProvider)
 	{
 		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("Unable to retrieve Gridly Provider."));
@@ -105,21 +107,53 @@ int32 UGridlyImportExportCommandlet::Main(const FString& Params)
 		return -1;
 	}
 
-	bool bDoImport = false;
+	bDoImport = false;
 	GConfig->GetBool(*SectionName, TEXT("bImportLoc"), bDoImport, ConfigPath);
 
-	bool bDoExport = false;
+	bDoExport = false;
 	GConfig->GetBool(*SectionName, TEXT("bExportLoc"), bDoExport, ConfigPath);
 
-	bool bDoDownloadSourceChanges = false;
+	bDoDownloadSourceChanges = false;
 	GConfig->GetBool(*SectionName, TEXT("bDownloadSourceChanges"), bDoDownloadSourceChanges, ConfigPath);
 
+	// Gather Text is skipped when its inputs did not change since the last successful run, unless forced
+	bForceGather = Switches.Contains(TEXT("ForceGather"));
+	if (!bForceGather)
+	{
+		GConfig->GetBool(*SectionName, TEXT("bForceGather"), bForceGather, ConfigPath);
+	}
+
+	// Cultures whose downloaded translations match the last successful import are not imported again, unless forced
+	bForceImport = Switches.Contains(TEXT("ForceImport"));
+	if (!bForceImport)
+	{
+		GConfig->GetBool(*SectionName, TEXT("bForceImport"), bForceImport, ConfigPath);
+	}
+
 	if (!bDoImport && !bDoExport && !bDoDownloadSourceChanges)
 	{
 		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No operation detected. Use bExportLoc, bImportLoc, or bDownloadSourceChanges in config section."));
 		return -1;
 	}
 
+	// How many targets may be in flight at once (1 processes targets strictly one after the other)
+	int32 MaxConcurrentTargets = 1;
+	GConfig->GetInt(*SectionName, TEXT("MaxConcurrentTargets"), MaxConcurrentTargets, ConfigPath);
+	if (const FString* MaxConcurrentTargetsParamVal = ParamVals.Find(FString(TEXT("MaxConcurrentTargets"))))
+	{
+		MaxConcurrentTargets = FCString::Atoi(**MaxConcurrentTargetsParamVal);
+	}
+	MaxConcurrentTargets = FMath::Max(1, MaxConcurrentTargets);
+
+	// How many gather/import/report subprocesses may run at once across all targets
+	MaxConcurrentLocCommandlets = 1;
+	GConfig->GetInt(*SectionName, TEXT("MaxConcurrentLocCommandlets"), MaxConcurrentLocCommandlets, ConfigPath);
+	if (const FString* MaxConcurrentLocCommandletsParamVal = ParamVals.Find(FString(TEXT("MaxConcurrentLocCommandlets"))))
+	{
+		MaxConcurrentLocCommandlets = FCString::Atoi(**MaxConcurrentLocCommandletsParamVal);
+	}
+	MaxConcurrentLocCommandlets = FMath::Max(1, MaxConcurrentLocCommandlets);
+
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== CONFIGURATION ==="));
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Operations: Import=%s, Export=%s, DownloadSourceChanges=%s"), 
 		bDoImport ? TEXT("true") : TEXT("false"),
@@ -127,6 +161,8 @@ int32 UGridlyImportExportCommandlet::Main(const FString& Params)
 		bDoDownloadSourceChanges ? TEXT("true") : TEXT("false"));
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Config Path: %s"), *ConfigPath);
 	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Section Name: %s"), *SectionName);
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Concurrency: MaxConcurrentTargets=%d, MaxConcurrentLocCommandlets=%d"),
+		MaxConcurrentTargets, MaxConcurrentLocCommandlets);
 
 	const TArray<ULocalizationTarget*> LocalizationTargets = ULocalizationSettings::GetGameTargetSet()->TargetObjects;
 	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Found %d localization targets"), LocalizationTargets.Num());
@@ -136,1001 +172,678 @@ int32 UGridlyImportExportCommandlet::Main(const FString& Params)
 		UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("No localization targets found!"));
 		return 0;
 	}
-	
-	//ULocalizationTarget* FirstLocTarget = LocalizationTargets.Num() > 0 ? LocalizationTargets[0]: nullptr;
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== STARTING MAIN LOOP ==="));
+
+	TargetJobs.Reset();
 	for (ULocalizationTarget* LocTarget : LocalizationTargets)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Processing target: %s"), LocTarget ? *LocTarget->GetName() : TEXT("NULL"));
-		// Do something with LocTarget
+		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Queueing target: %s"), LocTarget ? *LocTarget->GetName() : TEXT("NULL"));
 		if (LocTarget != nullptr)
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Target is valid, checking operations..."));
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("bDoImport=%s, bDoExport=%s, bDoDownloadSourceChanges=%s"), 
-				bDoImport ? TEXT("true") : TEXT("false"),
-				bDoExport ? TEXT("true") : TEXT("false"),
-				bDoDownloadSourceChanges ? TEXT("true") : TEXT("false"));
-			
-			if (bDoImport)
-			{
-				// List all cultures (even the native one in case some native translations have been modified in Gridly) to download
-				TArray<FString> Cultures;
-				for (int ItCulture = 0; ItCulture < LocTarget->Settings.SupportedCulturesStatistics.Num(); ItCulture++)
-				{
-					if (ItCulture != LocTarget->Settings.NativeCultureIndex)
-					{
-						const FCultureStatistics CultureStats = LocTarget->Settings.SupportedCulturesStatistics[ItCulture];
-						Cultures.Add(CultureStats.CultureName);
-					}
-				}
-
-				// Download cultures from Gridly
-				CulturesToDownload.Append(Cultures);
-				for (const FString& CultureName : Cultures)
-				{
-					ILocalizationServiceProvider& Provider = ILocalizationServiceModule::Get().GetProvider();
-					TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadTargetFileOp =
-						ILocalizationServiceOperation::Create<FDownloadLocalizationTargetFile>();
-					DownloadTargetFileOp->SetInTargetGuid(LocTarget->Settings.Guid);
-					DownloadTargetFileOp->SetInLocale(CultureName);
-
-					FString Path = FPaths::ProjectSavedDir() / "Temp" / "Game" / LocTarget->Settings.Name / CultureName /
-						LocTarget->Settings.Name + ".po";
-					FPaths::MakePathRelativeTo(Path, *FPaths::ProjectDir());
-					FString NormalizedPath = FPaths::ConvertRelativePathToFull(Path);
-					DownloadTargetFileOp->SetInRelativeOutputFilePathAndName(Path);
-
-					auto OperationCompleteDelegate = FLocalizationServiceOperationComplete::CreateUObject(this,
-						&UGridlyImportExportCommandlet::OnDownloadComplete, false);
-
-					Provider.Execute(DownloadTargetFileOp, TArray<FLocalizationServiceTranslationIdentifier>(),
-						ELocalizationServiceOperationConcurrency::Synchronous, OperationCompleteDelegate);
-				}
-
-				// Wait for all downloads
-				while (CulturesToDownload.Num())
-				{
-					FPlatformProcess::Sleep(0.4f);
-					FHttpModule::Get().GetHttpManager().Tick(-1.f);
-				}
-
-				// Run task to import po files, it will be done on the base folder and import all po files data generated after downloading data from gridly
-				if (CulturesToDownload.Num() == 0 && DownloadedFiles.Num() > 0)
-				{
-					const FString& DlPoFile = DownloadedFiles[0]; // retrieve first po file to deduce the base folder
-					const FString TargetName = FPaths::GetBaseFilename(DlPoFile);
-					const auto Target = ILocalizationModule::Get().GetLocalizationTargetByName(TargetName, false);
-
-					const FString DirectoryPath = FPaths::GetPath(DlPoFile);
-					const FString DownloadBasePath = FPaths::GetPath(DirectoryPath);
-
-					// Create commandlet task to Import texts
-					// Note that we could simply "Import all PO files" using a call to PortableObjectPipeline::ImportAll(...), though
-					//		using tasks we are able to easily add/remove call to existing localization functionalities
-					TArray<LocalizationCommandletExecution::FTask> Tasks;
-					const bool ShouldUseProjectFile = !Target->IsMemberOfEngineTargetSet();
-
-					// Normalize Import config path
-					FString ImportScriptPath = LocalizationConfigurationScript::GetImportTextConfigPath(Target, TOptional<FString>());
-					ImportScriptPath = FConfigCacheIni::NormalizeConfigIniPath(ImportScriptPath);
-					LocalizationConfigurationScript::GenerateImportTextConfigFile(Target, TOptional<FString>(), DownloadBasePath).WriteWithSCC(ImportScriptPath);
-					Tasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ImportTaskName", "Import Translations"), ImportScriptPath, ShouldUseProjectFile));
-
-					// Normalize Report config path
-					FString ReportScriptPath = LocalizationConfigurationScript::GetWordCountReportConfigPath(Target);
-					ReportScriptPath = FConfigCacheIni::NormalizeConfigIniPath(ReportScriptPath);
-					LocalizationConfigurationScript::GenerateWordCountReportConfigFile(Target).WriteWithSCC(ReportScriptPath);
-					Tasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ReportTaskName", "Generate Reports"), ReportScriptPath, ShouldUseProjectFile));
-
-
-					// Function will block until all tasks have been run
-					BlockingRunLocCommandletTask(Tasks);
-				}
-
-				// Cleanup
-				CulturesToDownload.Empty();
-				DownloadedFiles.Empty();
-			}
-
-			if (bDoExport)
-			{
-				UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Running gather text task before exporting to Gridly."));
-				// Generate gather config file
-				FString GatherScriptPath = LocalizationConfigurationScript::GetGatherTextConfigPath(LocTarget);
-				GatherScriptPath = FConfigCacheIni::NormalizeConfigIniPath(GatherScriptPath);
-
-				LocalizationConfigurationScript::GenerateGatherTextConfigFile(LocTarget).WriteWithSCC(GatherScriptPath);
-
-				const bool bUseProjectFile = !LocTarget->IsMemberOfEngineTargetSet();
-
-				LocalizationCommandletExecution::FTask GatherTask(
-					LOCTEXT("GatherTaskName", "Gather Text"),
-					GatherScriptPath,
-					bUseProjectFile
-				);
-
-				// Run Gather before Export
-				BlockingRunLocCommandletTask({ GatherTask });
-
-				FHttpRequestCompleteDelegate ReqDelegate = GridlyProvider->CreateExportNativeCultureDelegate();
-				const FText SlowTaskText = LOCTEXT("ExportNativeCultureForTargetToGridlyText", "Exporting native culture for target to Gridly");
-
-				GridlyProvider->ExportForTargetToGridly(LocTarget, ReqDelegate, SlowTaskText);
-
-				// Wait for export requests to complete
-				while (GridlyProvider->HasRequestsPending())
-				{
-					FPlatformProcess::Sleep(0.4f);
-					FHttpModule::Get().GetHttpManager().Tick(-1.f);
-				}
-
-				const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
-				if (GameSettings && GameSettings->bSyncRecords)
-				{
-					UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("Fetching Gridly CSV to check for stale records to delete..."));
-					UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("First check: HasDeleteRequestsPending = %s"),
-						GridlyProvider->HasDeleteRequestsPending() ? TEXT("true") : TEXT("false"));
-
-					// Wait for delete requests to finish
-					while (GridlyProvider->HasDeleteRequestsPending())
-					{
-						FPlatformProcess::Sleep(0.4f);
-						FHttpModule::Get().GetHttpManager().Tick(-1.f);
-					}
-					UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("All record deletions completed."));
-
-				}
-
-			}
-
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== CHECKING DOWNLOAD SOURCE CHANGES ==="));
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("bDoDownloadSourceChanges = %s"), bDoDownloadSourceChanges ? TEXT("true") : TEXT("false"));
-			
-			if (bDoDownloadSourceChanges)
-			{
-				UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== RUNNING DOWNLOAD SOURCE CHANGES TASK ==="));
-				UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Running Download Source Changes task for target: %s"), *LocTarget->Settings.Name);
-				
-				// Get the native culture for source strings
-				FString NativeCulture;
-				if (LocTarget->Settings.SupportedCulturesStatistics.IsValidIndex(LocTarget->Settings.NativeCultureIndex))
-				{
-					const FCultureStatistics CultureStats = LocTarget->Settings.SupportedCulturesStatistics[LocTarget->Settings.NativeCultureIndex];
-					NativeCulture = CultureStats.CultureName;
-				}
-				else
-				{
-					UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No native culture found for target: %s"), *LocTarget->Settings.Name);
-					continue;
-				}
-
-				// Check if we have any supported cultures
-				if (LocTarget->Settings.SupportedCulturesStatistics.Num() == 0)
-				{
-					UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No supported cultures found for target: %s"), *LocTarget->Settings.Name);
-					continue;
-				}
-
-				// Call the EXACT SAME FUNCTION that the UI uses
-				ILocalizationServiceModule& UILocServiceModule = ILocalizationServiceModule::Get();
-				ILocalizationServiceProvider& UILocServProvider = UILocServiceModule.GetProvider();
-				
-				const bool bCanUseUIGridly = UILocServProvider.IsEnabled() && UILocServProvider.IsAvailable() && UILocServProvider.GetName().ToString() == TEXT("Gridly");
-				
-				if (bCanUseUIGridly)
-				{
-					FGridlyLocalizationServiceProvider* UIGridlyProvider = static_cast<FGridlyLocalizationServiceProvider*>(&UILocServProvider);
-					if (UIGridlyProvider)
-					{
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔄 Running Download Source Changes (synchronous version)..."));
-					
-					// Use the commandlet's own synchronous implementation
-					DownloadSourceChangesFromGridlyInternal(LocTarget, NativeCulture);
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Download Source Changes completed"));
-					
-					// Save the localization target to persist changes
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("💾 Saving localization target: %s"), *LocTarget->Settings.Name);
-					LocTarget->SaveConfig();
-					
-					// Save all modified string table packages to disk (automated version of UI)
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("💾 Saving modified string table packages to disk..."));
-					for (TObjectIterator<UPackage> PackageIt; PackageIt; ++PackageIt)
-					{
-						UPackage* Package = *PackageIt;
-						if (Package && Package->IsDirty())
-						{
-							FString PackageName = Package->GetName();
-							if (PackageName.Contains(TEXT("StringTable")) || PackageName.Contains(TEXT("new_table_56")))
-							{
-								UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("💾 Saving dirty package: %s"), *PackageName);
-								
-								// Get the package file path
-								FString PackagePath = Package->GetLoadedPath().GetPackageName();
-								UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Package path: %s"), *PackagePath);
-								
-								// Handle packages with empty paths (newly created packages)
-								if (PackagePath.IsEmpty())
-								{
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🆕 Newly created package detected: %s"), *PackageName);
-									
-									// For newly created string tables, use the configured save path from plugin settings
-									const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
-									FString StringTableSavePath = GameSettings->StringTableSavePath;
-									if (StringTableSavePath.IsEmpty())
-									{
-										StringTableSavePath = TEXT("/Game/Localization/StringTables"); // Default fallback
-									}
-									
-									// Extract just the table name from the package name (remove the path prefix)
-									FString TableName = PackageName;
-									if (TableName.Contains(TEXT("/")))
-									{
-										TableName = TableName.Mid(TableName.Find(TEXT("/"), ESearchCase::IgnoreCase, ESearchDir::FromEnd) + 1);
-									}
-									
-									FString ConstructedPath = FString::Printf(TEXT("%s/%s"), *StringTableSavePath, *TableName);
-									
-									// Convert the package path to a relative file path
-									FString RelativePath = ConstructedPath.Replace(TEXT("/Game/"), TEXT("Content/"));
-									FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), RelativePath + FPackageName::GetAssetPackageExtension());
-									
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Using StringTableSavePath: %s"), *StringTableSavePath);
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Extracted table name: %s"), *TableName);
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Constructed package path: %s"), *ConstructedPath);
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Relative path: %s"), *RelativePath);
-									UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 Constructed file path: %s"), *FilePath);
-									
-									// Save the newly created package
-									FSavePackageArgs SaveArgs;
-									SaveArgs.TopLevelFlags = RF_NoFlags;
-									bool bSaved = UPackage::SavePackage(Package, nullptr, *FilePath, SaveArgs);
-									if (bSaved)
-									{
-										UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Successfully saved newly created package: %s to %s"), *PackageName, *FilePath);
-									}
-									else
-									{
-										UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Failed to save newly created package: %s to %s"), *PackageName, *FilePath);
-									}
-									continue;
-								}
-								
-								// Convert package path to actual file path
-								FString FilePath = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-								UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔍 File path: %s"), *FilePath);
-								
-								if (!FilePath.IsEmpty())
-								{
-									// Save the package to disk
-									FSavePackageArgs SaveArgs;
-									SaveArgs.TopLevelFlags = RF_NoFlags;
-									bool bSaved = UPackage::SavePackage(Package, nullptr, *FilePath, SaveArgs);
-									if (bSaved)
-									{
-										UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Successfully saved package: %s to %s"), *PackageName, *FilePath);
-									}
-									else
-									{
-										UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Failed to save package: %s to %s"), *PackageName, *FilePath);
-									}
-								}
-								else
-								{
-									UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("⚠️ No file path for package: %s"), *PackageName);
-								}
-							}
-						}
-					}
-					
-					// Force garbage collection to ensure all string table changes are committed
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🗑️ Forcing garbage collection to commit string table changes..."));
-					CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Garbage collection completed"));
-					
-					// Refresh asset registry to ensure string table changes are visible
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔄 Refreshing asset registry to make string table changes visible..."));
-					FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-					AssetRegistryModule.Get().ScanModifiedAssetFiles(TArray<FString>());
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Asset registry refreshed"));
-					
-					// Run "Gather Text" to update manifest files from the updated string tables
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("📝 Running Gather Text to update manifest files..."));
-					
-					// Generate gather text config file
-					FString GatherScriptPath = LocalizationConfigurationScript::GetGatherTextConfigPath(LocTarget);
-					LocalizationConfigurationScript::GenerateGatherTextConfigFile(LocTarget).WriteWithSCC(GatherScriptPath);
-					
-					const bool bUseProjectFile = !LocTarget->IsMemberOfEngineTargetSet();
-					LocalizationCommandletExecution::FTask GatherTask(
-						LOCTEXT("GatherTaskName", "Gather Text"),
-						GatherScriptPath,
-						bUseProjectFile
-					);
-					
-					// Execute the gather text task
-					BlockingRunLocCommandletTask({ GatherTask });
-					UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Gather Text completed - manifest files updated"));
-					}
-					else
-					{
-						UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ UIGridlyProvider cast failed"));
-					}
-				}
-				else
-				{
-					UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Cannot use UI GridlyProvider"));
-				}
-			}
+			FGridlyCommandletTargetJob& Job = TargetJobs.AddDefaulted_GetRef();
+			Job.Target = LocTarget;
 		}
 
-
 		if (ExportAllGameTargetPtr && *ExportAllGameTargetPtr == "false") {
 			break;
 		}
 	}
-	return 0;
-}
 
-void UGridlyImportExportCommandlet::OnDownloadComplete(const FLocalizationServiceOperationRef& Operation, ELocalizationServiceOperationCommandResult::Type Result, bool bIsTargetSet)
-{
-	// do like in FGridlyLocalizationServiceProvider::OnImportCultureForTargetFromGridly
-	TSharedPtr<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadLocalizationTargetOp = StaticCastSharedRef<FDownloadLocalizationTargetFile>(Operation);
-	CulturesToDownload.Remove(DownloadLocalizationTargetOp->GetInLocale());
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== STARTING MAIN LOOP ==="));
+	const bool bCompleted = RunTargetPipeline(MaxConcurrentTargets);
 
-	if (Result != ELocalizationServiceOperationCommandResult::Succeeded)
+	FGridlyPerfCounters::LogSummary();
+
+	if (NumFailedTargets > 0)
 	{
-		const FText ErrorMessage = DownloadLocalizationTargetOp->GetOutErrorText();
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("%s"), *ErrorMessage.ToString());
+		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("%d targets failed"), NumFailedTargets);
 	}
 
-	const FString TargetName = FPaths::GetBaseFilename(DownloadLocalizationTargetOp->GetInRelativeOutputFilePathAndName());
-
-	const auto Target = ILocalizationModule::Get().GetLocalizationTargetByName(TargetName, false);
-	const FString AbsoluteFilePathAndName = FPaths::ConvertRelativePathToFull(
-		FPaths::ProjectDir() / DownloadLocalizationTargetOp->GetInRelativeOutputFilePathAndName());
-
-	DownloadedFiles.Add(AbsoluteFilePathAndName);
+	return bCompleted && NumFailedTargets == 0 ? 0 : 1;
 }
 
-void UGridlyImportExportCommandlet::BlockingRunLocCommandletTask(const TArray<LocalizationCommandletExecution::FTask>& Tasks)
+bool UGridlyImportExportCommandlet::RunTargetPipeline(const int32 MaxConcurrentTargets)
 {
-	for (const LocalizationCommandletExecution::FTask& LocTask : Tasks)
-	{
-		TSharedPtr<FLocalizationCommandletProcess> CommandletProcess = FLocalizationCommandletProcess::Execute(LocTask.ScriptPath, LocTask.ShouldUseProjectFile);
+	LogHeadJobIndex = 0;
+	RunningLocCommandlets = 0;
+	NumFailedTargets = 0;
+	double LastTickTime = FPlatformTime::Seconds();
 
-		if (CommandletProcess.IsValid())
+	while (LogHeadJobIndex < TargetJobs.Num())
+	{
+		// Ctrl-C requests an engine exit, so stop the Gridly work in flight instead of finishing every target first
+		if (IsEngineExitRequested())
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("=== Starting Task [%s] ==="), *LocTask.Name.ToString());
-
-			FProcHandle CurrentProcessHandle = CommandletProcess->GetHandle();
-			int32 ReturnCode = INDEX_NONE;
-
-			// This loop is the same than FCommandletLogPump::Run(), and it's used when SLocalizationCommandletExecutor widget runs localization commandlet tasks
-			for (;;)
-			{
-				// Read from pipe.
-				const FString PipeString = FPlatformProcess::ReadPipe(CommandletProcess->GetReadPipe());
-
-				// Process buffer.
-				if (!PipeString.IsEmpty())
-				{
-					UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("%s"), *PipeString);
-				}
+			UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("Exit requested, cancelling the remaining targets"));
+			GridlyProvider->CancelAll();
 
-				// If the process isn't running and there's no data in the pipe, we're done.
-				if (!FPlatformProcess::IsProcRunning(CurrentProcessHandle) && PipeString.IsEmpty())
-				{
-					break;
-				}
+			// Releasing the jobs also ends their running loc commandlet processes
+			TargetJobs.Empty();
+			return false;
+		}
 
-				// Sleep.
-				FPlatformProcess::Sleep(0.0f);
-			}
+		// Only the oldest unfinished target and the ones right behind it are advanced
+		const int32 WindowEnd = FMath::Min(LogHeadJobIndex + MaxConcurrentTargets, TargetJobs.Num());
+		for (int32 JobIndex = LogHeadJobIndex; JobIndex < WindowEnd; ++JobIndex)
+		{
+			TickTargetJob(JobIndex);
+		}
 
-			if (CurrentProcessHandle.IsValid() && FPlatformProcess::GetProcReturnCode(CurrentProcessHandle, &ReturnCode))
+		// Move the log head past finished targets and replay what the next one logged in the meantime
+		while (LogHeadJobIndex < TargetJobs.Num() && TargetJobs[LogHeadJobIndex].Stage == EGridlyCommandletTargetStage::Done)
+		{
+			NumFailedTargets += TargetJobs[LogHeadJobIndex].bFailed ? 1 : 0;
+			++LogHeadJobIndex;
+			if (LogHeadJobIndex < TargetJobs.Num())
 			{
-				UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("===> Task [%s] returned : %d"), *LocTask.Name.ToString(), ReturnCode);
+				FlushTargetJobLog(LogHeadJobIndex);
 			}
 		}
-		else
+
+		if (LogHeadJobIndex < TargetJobs.Num())
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("Failed to start Task [%s] !"), *LocTask.Name.ToString());
+			FPlatformProcess::Sleep(0.05f);
+			FHttpModule::Get().GetHttpManager().Tick(-1.f);
+
+			// Downloads wait between pages on the core ticker, which nothing else ticks in a commandlet
+			const double Now = FPlatformTime::Seconds();
+			FTSTicker::GetCoreTicker().Tick(static_cast<float>(Now - LastTickTime));
+			LastTickTime = Now;
+
+			// Source changes are applied to string tables from the provider's Tick
+			GridlyProvider->Tick();
 		}
 	}
+
+	TargetJobs.Empty();
+	return true;
 }
 
-void UGridlyImportExportCommandlet::DownloadSourceChangesFromGridlyInternal(ULocalizationTarget* LocalizationTarget, const FString& NativeCulture)
+void UGridlyImportExportCommandlet::TickTargetJob(const int32 JobIndex)
 {
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== DownloadSourceChangesFromGridlyInternal START ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Target: %s, Culture: %s"), *LocalizationTarget->Settings.Name, *NativeCulture);
-	
-	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
-	const FString ApiKey = GameSettings->ImportApiKey;
-
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("API Key configured: %s"), ApiKey.IsEmpty() ? TEXT("NO") : TEXT("YES"));
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Import View IDs count: %d"), GameSettings->ImportFromViewIds.Num());
-
-	if (ApiKey.IsEmpty())
+	FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
+	if (Job.Stage == EGridlyCommandletTargetStage::Done)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No import API key configured"));
 		return;
 	}
 
-	// Get the first view ID for import
-	if (GameSettings->ImportFromViewIds.Num() == 0 || GameSettings->ImportFromViewIds[0].IsEmpty())
+	ULocalizationTarget* LocTarget = Job.Target.Get();
+	if (!LocTarget)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No import view ID configured"));
+		LogForJob(JobIndex, ELogVerbosity::Error, TEXT("Localization target is no longer valid, skipping it."));
+		Job.Stage = EGridlyCommandletTargetStage::Done;
 		return;
 	}
 
-	const FString ViewId = GameSettings->ImportFromViewIds[0];
-	const FString Url = FString::Printf(TEXT("https://api.gridly.com/v1/views/%s/records"), *ViewId);
-
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-	HttpRequest->SetURL(Url);
-
-	// Store the localization target and culture for the callback
-	CurrentSourceDownloadTarget = LocalizationTarget;
-	CurrentSourceDownloadCulture = NativeCulture;
-
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UGridlyImportExportCommandlet::OnDownloadSourceChangesFromGridly);
-	HttpRequest->ProcessRequest();
-
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== MAKING HTTP REQUEST TO GRIDLY ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Downloading source changes from Gridly for target: %s, culture: %s"), 
-		*LocalizationTarget->Settings.Name, *NativeCulture);
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("URL: %s"), *Url);
-
-	// Wait for the request to complete
-	while (HttpRequest->GetStatus() == EHttpRequestStatus::Processing)
+	if (Job.Stage == EGridlyCommandletTargetStage::Queued)
 	{
-		FPlatformProcess::Sleep(0.1f);
-		FHttpModule::Get().GetHttpManager().Tick(-1.f);
+		LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("Processing target: %s"), *LocTarget->GetName()));
+		Job.Stage = GetNextStage(Job.Stage);
+		Job.bStageStarted = false;
 	}
-}
 
-void UGridlyImportExportCommandlet::OnDownloadSourceChangesFromGridly(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
-{
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== HTTP RESPONSE RECEIVED ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Success: %s"), bSuccess ? TEXT("YES") : TEXT("NO"));
-	
-	if (!bSuccess || !Response.IsValid())
+	if (!Job.bStageStarted)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("Failed to download source changes from Gridly"));
-		return;
+		// Stages that share provider state wait here until they can run
+		if (!StartTargetJobStage(JobIndex))
+		{
+			return;
+		}
+		Job.bStageStarted = true;
 	}
 
-	const FString ResponseContent = Response->GetContentAsString();
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Response content length: %d characters"), ResponseContent.Len());
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Response status code: %d"), Response->GetResponseCode());
-	
-	// Parse the JSON response to get the records
-	TArray<TSharedPtr<FJsonValue>> RecordsArray;
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-	
-	if (!FJsonSerializer::Deserialize(JsonReader, RecordsArray))
+	if (!TickLocCommandletTasks(JobIndex) || !IsTargetJobStageComplete(JobIndex))
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("Failed to parse JSON response from Gridly"));
 		return;
 	}
 
-	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Successfully parsed %d records from Gridly"), RecordsArray.Num());
+	Job.Stage = GetNextStage(Job.Stage);
+	Job.bStageStarted = false;
 
-	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
+	if (Job.Stage == EGridlyCommandletTargetStage::Done)
+	{
+		LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("Finished target: %s"), *LocTarget->GetName()));
+	}
+}
 
-	// Process the records and group them by namespace
-	TMap<FString, TArray<FGridlySourceRecord>> NamespaceRecords;
-	
-	for (const TSharedPtr<FJsonValue>& RecordValue : RecordsArray)
+EGridlyCommandletTargetStage UGridlyImportExportCommandlet::GetNextStage(const EGridlyCommandletTargetStage Stage) const
+{
+	for (uint8 Next = static_cast<uint8>(Stage) + 1; Next < static_cast<uint8>(EGridlyCommandletTargetStage::Done); ++Next)
 	{
-		const TSharedPtr<FJsonObject> RecordObj = RecordValue->AsObject();
-		if (!RecordObj.IsValid())
+		switch (static_cast<EGridlyCommandletTargetStage>(Next))
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("Invalid record object, skipping"));
-			continue;
+		case EGridlyCommandletTargetStage::ImportDownload:
+		case EGridlyCommandletTargetStage::ImportTasks:
+			if (bDoImport)
+			{
+				return static_cast<EGridlyCommandletTargetStage>(Next);
+			}
+			break;
+		case EGridlyCommandletTargetStage::ExportGather:
+		case EGridlyCommandletTargetStage::ExportUpload:
+			if (bDoExport)
+			{
+				return static_cast<EGridlyCommandletTargetStage>(Next);
+			}
+			break;
+		case EGridlyCommandletTargetStage::DownloadSourceChanges:
+		case EGridlyCommandletTargetStage::SaveSourceChanges:
+			if (bDoDownloadSourceChanges)
+			{
+				return static_cast<EGridlyCommandletTargetStage>(Next);
+			}
+			break;
+		default:
+			break;
 		}
+	}
 
-		FGridlySourceRecord SourceRecord;
-		SourceRecord.RecordId = RecordObj->GetStringField(TEXT("id"));
-		
-		// Path (namespace): top-level "path" first, then from path column in cells (NamespaceColumnId)
-		FString PathFromRecord;
-		if (RecordObj->TryGetStringField(TEXT("path"), PathFromRecord))
+	return EGridlyCommandletTargetStage::Done;
+}
+
+bool UGridlyImportExportCommandlet::StartTargetJobStage(const int32 JobIndex)
+{
+	FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
+	ULocalizationTarget* LocTarget = Job.Target.Get();
+
+	switch (Job.Stage)
+	{
+	case EGridlyCommandletTargetStage::ImportDownload:
 		{
-			SourceRecord.Path = PathFromRecord;
+			// List all cultures (even the native one in case some native translations have been modified in Gridly) to download
+			TArray<FString> Cultures;
+			for (int ItCulture = 0; ItCulture < LocTarget->Settings.SupportedCulturesStatistics.Num(); ItCulture++)
+			{
+				if (ItCulture != LocTarget->Settings.NativeCultureIndex)
+				{
+					const FCultureStatistics CultureStats = LocTarget->Settings.SupportedCulturesStatistics[ItCulture];
+					Cultures.Add(CultureStats.CultureName);
+				}
+			}
+
+			// Download cultures from Gridly, completion is polled by IsTargetJobStageComplete
+			Job.CulturesToDownload.Append(Cultures);
+			TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>> DownloadOperations;
+			for (const FString& CultureName : Cultures)
+			{
+				TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadTargetFileOp =
+					ILocalizationServiceOperation::Create<FDownloadLocalizationTargetFile>();
+				DownloadTargetFileOp->SetInTargetGuid(LocTarget->Settings.Guid);
+				DownloadTargetFileOp->SetInLocale(CultureName);
+
+				FString Path = FPaths::ProjectSavedDir() / "Temp" / "Game" / LocTarget->Settings.Name / CultureName /
+					LocTarget->Settings.Name + ".po";
+				FPaths::MakePathRelativeTo(Path, *FPaths::ProjectDir());
+				DownloadTargetFileOp->SetInRelativeOutputFilePathAndName(Path);
+
+				// A .po file left over from an earlier run must not stand in for a download that fails
+				IFileManager::Get().Delete(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Path), false, false, true);
+
+				DownloadOperations.Add(DownloadTargetFileOp);
+			}
+
+			// One download serves every culture of the target, the .po files are written in parallel
+			if (DownloadOperations.Num() > 0)
+			{
+				auto OperationCompleteDelegate = FLocalizationServiceOperationComplete::CreateUObject(this,
+					&UGridlyImportExportCommandlet::OnDownloadComplete, JobIndex);
+
+				GridlyProvider->ExecuteDownloads(DownloadOperations, OperationCompleteDelegate);
+			}
+			return true;
 		}
 
-		UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Processing record ID: %s"), *SourceRecord.RecordId);
-		
-		// Get source text and path (namespace) from cells
-		if (RecordObj->HasField(TEXT("cells")))
+	case EGridlyCommandletTargetStage::ImportTasks:
 		{
-			const TSharedPtr<FJsonValue> CellsValue = RecordObj->TryGetField(TEXT("cells"));
-			if (CellsValue.IsValid() && !CellsValue->IsNull())
+			// Run task to import po files, it will be done on the base folder and import all po files data generated after downloading data from gridly
+			if (Job.DownloadedFiles.Num() > 0)
 			{
-				// Check if cells is an array (which is the correct format from Gridly)
-				if (CellsValue->Type == EJson::Array)
+				const FString& DlPoFile = Job.DownloadedFiles[0]; // retrieve first po file to deduce the base folder
+				const FString DirectoryPath = FPaths::GetPath(DlPoFile);
+				const FString DownloadBasePath = FPaths::GetPath(DirectoryPath);
+
+				// Only import the cultures whose .po content changed since the last successful import, failed downloads are left out too
+				TArray<FString> UnchangedCultures;
+				Job.ImportedCultureHashes.Reset();
+				if (bForceImport)
 				{
-					const TArray<TSharedPtr<FJsonValue>> CellsArray = CellsValue->AsArray();
-					
-					FString SourceColumnId = FString::Printf(TEXT("%s%s"), *GameSettings->SourceLanguageColumnIdPrefix, *CurrentSourceDownloadCulture.Replace(TEXT("-"), TEXT("")));
-					
-					UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Looking for source column ID: %s in %d cells"), *SourceColumnId, CellsArray.Num());
-					
-					for (const TSharedPtr<FJsonValue>& CellValue : CellsArray)
-					{
-						if (CellValue.IsValid() && !CellValue->IsNull())
-						{
-							const TSharedPtr<FJsonObject> CellObj = CellValue->AsObject();
-							if (CellObj.IsValid())
-							{
-								FString CellColumnId = CellObj->GetStringField(TEXT("columnId"));
-								FString CellValueStr = CellObj->GetStringField(TEXT("value"));
-								// Path/namespace from path column (NamespaceColumnId)
-								if (!GameSettings->NamespaceColumnId.IsEmpty() && CellColumnId == GameSettings->NamespaceColumnId)
-								{
-									SourceRecord.Path = CellValueStr;
-								}
-								else if (CellColumnId == SourceColumnId)
-								{
-									SourceRecord.SourceText = CellValueStr;
-									UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Found source text for record %s: %s"), *SourceRecord.RecordId, *SourceRecord.SourceText);
-									break;
-								}
-							}
-						}
-					}
+					Job.ImportedCultureHashes = Job.DownloadedCultureHashes;
 				}
-				// Fallback: try to handle as object (legacy format)
-				else if (CellsValue->Type == EJson::Object)
+				else
 				{
-					const TSharedPtr<FJsonObject> CellsObj = CellsValue->AsObject();
-					if (CellsObj.IsValid())
+					const TArray<FString> ChangedCultures = FGridlyChangeJournal::GetChangedImportCultures(LocTarget, Job.DownloadedCultureHashes);
+					for (const TPair<FString, FString>& CultureHash : Job.DownloadedCultureHashes)
 					{
-						FString SourceColumnId = FString::Printf(TEXT("%s%s"), *GameSettings->SourceLanguageColumnIdPrefix, *CurrentSourceDownloadCulture.Replace(TEXT("-"), TEXT("")));
-						
-						UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Looking for source column ID: %s (object format)"), *SourceColumnId);
-						
-						// Path from NamespaceColumnId if present
-						if (!GameSettings->NamespaceColumnId.IsEmpty() && CellsObj->HasField(GameSettings->NamespaceColumnId))
+						if (ChangedCultures.Contains(CultureHash.Key))
 						{
-							const TSharedPtr<FJsonValue> PathCellValue = CellsObj->TryGetField(GameSettings->NamespaceColumnId);
-							if (PathCellValue.IsValid() && !PathCellValue->IsNull())
-							{
-								const TSharedPtr<FJsonObject> PathCellObj = PathCellValue->AsObject();
-								if (PathCellObj.IsValid())
-								{
-									SourceRecord.Path = PathCellObj->GetStringField(TEXT("value"));
-								}
-							}
+							Job.ImportedCultureHashes.Add(CultureHash);
 						}
-						if (CellsObj->HasField(SourceColumnId))
+						else
 						{
-							const TSharedPtr<FJsonValue> CellValue = CellsObj->TryGetField(SourceColumnId);
-							if (CellValue.IsValid() && !CellValue->IsNull())
-							{
-								const TSharedPtr<FJsonObject> CellObj = CellValue->AsObject();
-								if (CellObj.IsValid())
-								{
-									SourceRecord.SourceText = CellObj->GetStringField(TEXT("value"));
-									UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Found source text for record %s: %s"), *SourceRecord.RecordId, *SourceRecord.SourceText);
-								}
-							}
+							UnchangedCultures.Add(CultureHash.Key);
 						}
 					}
 				}
+
+				if (Job.ImportedCultureHashes.Num() == 0 && Job.DownloadedCultureHashes.Num() > 0)
+				{
+					LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("📥 Import skipped for target %s: translations unchanged since the last successful import"),
+						*LocTarget->Settings.Name));
+				}
+				else
+				{
+					if (UnchangedCultures.Num() > 0)
+					{
+						LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("📥 Importing %d changed cultures for target %s, skipping unchanged: %s"),
+							Job.ImportedCultureHashes.Num(), *LocTarget->Settings.Name, *FString::Join(UnchangedCultures, TEXT(", "))));
+					}
+
+					// Create commandlet task to Import texts
+					// Note that we could simply "Import all PO files" using a call to PortableObjectPipeline::ImportAll(...), though
+					//		using tasks we are able to easily add/remove call to existing localization functionalities
+					const bool ShouldUseProjectFile = !LocTarget->IsMemberOfEngineTargetSet();
+
+					Job.ImportScriptPath = FGridlyLocalizationServiceProvider::GenerateImportTextConfigFile(LocTarget, DownloadBasePath,
+						FGridlyLocalizationServiceProvider::GetCulturesExcludedFromImport(LocTarget, Job.ImportedCultureHashes));
+					Job.PendingLocTasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ImportTaskName", "Import Translations"), Job.ImportScriptPath, ShouldUseProjectFile));
+
+					// Normalize Report config path
+					FString ReportScriptPath = LocalizationConfigurationScript::GetWordCountReportConfigPath(LocTarget);
+					ReportScriptPath = FConfigCacheIni::NormalizeConfigIniPath(ReportScriptPath);
+					LocalizationConfigurationScript::GenerateWordCountReportConfigFile(LocTarget).WriteWithSCC(ReportScriptPath);
+					Job.PendingLocTasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ReportTaskName", "Generate Reports"), ReportScriptPath, ShouldUseProjectFile));
+				}
 			}
+
+			// Cleanup
+			Job.CulturesToDownload.Empty();
+			Job.DownloadedFiles.Empty();
+			Job.DownloadedCultureHashes.Empty();
+			return true;
 		}
 
-		// Determine namespace: use path from API (cells or top-level), or from record ID when using combined namespace
-		FString Namespace = SourceRecord.Path;
-		FString Key = SourceRecord.RecordId;
-		
-		if (GameSettings->bUseCombinedNamespaceId && SourceRecord.RecordId.Contains(TEXT(",")))
+	case EGridlyCommandletTargetStage::ExportGather:
 		{
-			FString Left, Right;
-			if (SourceRecord.RecordId.Split(TEXT(","), &Left, &Right))
-			{
-				Namespace = Left;
-				Key = Right;
-			}
+			// Run Gather before Export
+			LogForJob(JobIndex, ELogVerbosity::Log, TEXT("Checking gather text task before exporting to Gridly."));
+			QueueGatherTaskIfNeeded(JobIndex);
+			return true;
 		}
-		
-		Namespace = Namespace.Replace(TEXT(" "), TEXT(""));
-		if (Namespace.IsEmpty())
+
+	case EGridlyCommandletTargetStage::ExportUpload:
 		{
-			Namespace = TEXT("Default");
+			// The provider holds a single export queue and logs directly, so only the log head may export
+			if (JobIndex != LogHeadJobIndex || GridlyProvider->HasRequestsPending() || GridlyProvider->HasDeleteRequestsPending())
+			{
+				return false;
+			}
+
+			FHttpRequestCompleteDelegate ReqDelegate = GridlyProvider->CreateExportNativeCultureDelegate();
+			const FText SlowTaskText = LOCTEXT("ExportNativeCultureForTargetToGridlyText", "Exporting native culture for target to Gridly");
+
+			GridlyProvider->ExportForTargetToGridly(LocTarget, ReqDelegate, SlowTaskText);
+			return true;
 		}
-		
-		// Log if we didn't find any source text
-		if (SourceRecord.SourceText.IsEmpty())
+
+	case EGridlyCommandletTargetStage::DownloadSourceChanges:
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("No source text found for record %s"), *SourceRecord.RecordId);
+			// The provider holds one source changes download at a time and logs directly, so only the log head may run it
+			if (JobIndex != LogHeadJobIndex)
+			{
+				return false;
+			}
+
+			// A download that could not start completes the stage at once, SaveSourceChanges then reports it
+			Job.bFailed = !StartDownloadSourceChanges(JobIndex);
+			return true;
 		}
-		
-		SourceRecord.RecordId = Key;
-		
-		// Add to namespace records
-		if (!NamespaceRecords.Contains(Namespace))
+
+	case EGridlyCommandletTargetStage::SaveSourceChanges:
 		{
-			NamespaceRecords.Add(Namespace, TArray<FGridlySourceRecord>());
+			if (Job.bFailed || GridlyProvider->HasSourceDownloadFailed())
+			{
+				LogForJob(JobIndex, ELogVerbosity::Error, FString::Printf(TEXT("❌ Download Source Changes failed for target: %s"),
+					*LocTarget->Settings.Name));
+				Job.bFailed = true;
+				return true;
+			}
+
+			SaveSourceChanges(JobIndex);
+			return true;
 		}
-		NamespaceRecords[Namespace].Add(SourceRecord);
-	}
 
-	// Process the namespace records
-	ProcessSourceChangesForNamespaces(NamespaceRecords);
+	default:
+		return true;
+	}
 }
 
-void UGridlyImportExportCommandlet::ProcessSourceChangesForNamespaces(const TMap<FString, TArray<FGridlySourceRecord>>& NamespaceRecords)
+bool UGridlyImportExportCommandlet::IsTargetJobStageComplete(const int32 JobIndex) const
 {
-	if (!CurrentSourceDownloadTarget.IsValid())
-	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("Invalid localization target for source changes processing"));
-		return;
-	}
+	const FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
 
-	ULocalizationTarget* LocalizationTarget = CurrentSourceDownloadTarget.Get();
-	const FString TargetName = LocalizationTarget->Settings.Name;
-	
-	// Create temporary directory for CSV files
-	const FString TempDir = FPaths::ProjectSavedDir() / TEXT("Temp") / TEXT("GridlySourceChanges") / TargetName;
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	
-	if (!PlatformFile.DirectoryExists(*TempDir))
+	switch (Job.Stage)
 	{
-		PlatformFile.CreateDirectoryTree(*TempDir);
+	case EGridlyCommandletTargetStage::ImportDownload:
+		return Job.CulturesToDownload.Num() == 0;
+
+	case EGridlyCommandletTargetStage::DownloadSourceChanges:
+		return Job.bFailed || !GridlyProvider->IsSourceDownloadPending();
+
+	case EGridlyCommandletTargetStage::ExportUpload:
+		{
+			// Wait for export requests to complete
+			if (GridlyProvider->HasRequestsPending())
+			{
+				return false;
+			}
+
+			// Wait for delete requests to finish
+			const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
+			if (GameSettings && GameSettings->bSyncRecords && GridlyProvider->HasDeleteRequestsPending())
+			{
+				return false;
+			}
+			return true;
+		}
+
+	default:
+		return true;
 	}
+}
 
-	int32 ProcessedNamespaces = 0;
-	int32 TotalNamespaces = NamespaceRecords.Num();
+bool UGridlyImportExportCommandlet::TickLocCommandletTasks(const int32 JobIndex)
+{
+	FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
 
-	for (const auto& NamespacePair : NamespaceRecords)
+	for (;;)
 	{
-		const FString& Namespace = NamespacePair.Key;
-		const TArray<FGridlySourceRecord>& Records = NamespacePair.Value;
+		if (Job.RunningLocProcess.IsValid())
+		{
+			// Same pump as FCommandletLogPump::Run(), one read per tick so other targets keep progressing
+			const FString PipeString = FPlatformProcess::ReadPipe(Job.RunningLocProcess->GetReadPipe());
+			if (!PipeString.IsEmpty())
+			{
+				LogForJob(JobIndex, ELogVerbosity::Log, PipeString);
+			}
 
-		ProcessedNamespaces++;
-		UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Processing namespace %d/%d: %s (%d records)"), 
-			ProcessedNamespaces, TotalNamespaces, *Namespace, Records.Num());
+			FProcHandle CurrentProcessHandle = Job.RunningLocProcess->GetHandle();
+			if (FPlatformProcess::IsProcRunning(CurrentProcessHandle) || !PipeString.IsEmpty())
+			{
+				return false;
+			}
 
-		// Generate CSV content
-		FString CSVContent = TEXT("Key,SourceString\n");
-		
-		for (const FGridlySourceRecord& Record : Records)
-		{
-			// Escape quotes in the source text
-			FString EscapedSourceText = Record.SourceText;
-			EscapedSourceText = EscapedSourceText.Replace(TEXT("\""), TEXT("\"\""));
-			
-			CSVContent += FString::Printf(TEXT("\"%s\",\"%s\"\n"), *Record.RecordId, *EscapedSourceText);
-		}
+			int32 ReturnCode = INDEX_NONE;
+			if (CurrentProcessHandle.IsValid() && FPlatformProcess::GetProcReturnCode(CurrentProcessHandle, &ReturnCode))
+			{
+				LogForJob(JobIndex, ELogVerbosity::Log, FString::Printf(TEXT("===> Task [%s] returned : %d"), *Job.RunningLocTaskName.ToString(), ReturnCode));
+			}
 
-		// Write CSV file
-		const FString CSVFilePath = TempDir / FString::Printf(TEXT("%s.csv"), *Namespace);
-		
-		if (FFileHelper::SaveStringToFile(CSVContent, *CSVFilePath))
-		{
-			UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Generated CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
-			
-			// Import the CSV into the string table
-			ImportCSVToStringTable(LocalizationTarget, Namespace, CSVFilePath);
+			if (Job.bRunningGather)
+			{
+				ULocalizationTarget* LocTarget = Job.Target.Get();
+				if (ReturnCode == 0 && LocTarget)
+				{
+					FGridlyChangeJournal::RecordHash(TEXT("Gather"), LocTarget->Settings.Name, Job.GatherInputsHash);
+				}
+				else
+				{
+					LogForJob(JobIndex, ELogVerbosity::Warning, TEXT("Gather Text did not succeed, its inputs are not recorded and it will run again next time."));
+				}
+				Job.bRunningGather = false;
+			}
+
+			if (Job.bRunningImport)
+			{
+				ULocalizationTarget* LocTarget = Job.Target.Get();
+				if (ReturnCode == 0 && LocTarget)
+				{
+					FGridlyChangeJournal::RecordImportedCultures(LocTarget, Job.ImportedCultureHashes);
+				}
+				else
+				{
+					LogForJob(JobIndex, ELogVerbosity::Warning, TEXT("Import Translations did not succeed, its cultures are not recorded and they will be imported again next time."));
+				}
+				Job.bRunningImport = false;
+			}
+
+			Job.RunningLocProcess.Reset();
+			--RunningLocCommandlets;
 		}
-		else
+
+		if (Job.PendingLocTasks.Num() == 0)
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("Failed to write CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
+			return true;
 		}
-	}
 
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== SOURCE CHANGES PROCESSING COMPLETED ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Processed %d namespaces. CSV files saved to: %s"), 
-		ProcessedNamespaces, *TempDir);
-	
-	// Now import the CSV files to update the string tables
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== IMPORTING CSV FILES TO UPDATE STRING TABLES ==="));
-	for (const auto& NamespacePair : NamespaceRecords)
-	{
-		const FString& Namespace = NamespacePair.Key;
-		const FString CSVFilePath = TempDir / FString::Printf(TEXT("%s.csv"), *Namespace);
-		
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Importing CSV file: %s"), *CSVFilePath);
-		
-		// Import the CSV file to update the string table
-		bool bImportSuccess = ImportCSVToStringTable(LocalizationTarget, Namespace, CSVFilePath);
-		if (bImportSuccess)
+		if (RunningLocCommandlets >= MaxConcurrentLocCommandlets)
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Successfully imported CSV for namespace: %s"), *Namespace);
+			return false;
 		}
-		else
+
+		const LocalizationCommandletExecution::FTask LocTask = Job.PendingLocTasks[0];
+		Job.PendingLocTasks.RemoveAt(0);
+
+		Job.RunningLocProcess = FLocalizationCommandletProcess::Execute(LocTask.ScriptPath, LocTask.ShouldUseProjectFile);
+		if (Job.RunningLocProcess.IsValid())
 		{
-			UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("⚠️ Failed to import CSV for namespace: %s"), *Namespace);
+			LogForJob(JobIndex, ELogVerbosity::Log, FString::Printf(TEXT("=== Starting Task [%s] ==="), *LocTask.Name.ToString()));
+			Job.RunningLocTaskName = LocTask.Name;
+			Job.bRunningGather = !Job.GatherScriptPath.IsEmpty() && LocTask.ScriptPath == Job.GatherScriptPath;
+			Job.bRunningImport = !Job.ImportScriptPath.IsEmpty() && LocTask.ScriptPath == Job.ImportScriptPath;
+			++RunningLocCommandlets;
+			return false;
 		}
-	}
-	
-	// Save the localization target to persist changes
-	if (LocalizationTarget)
-	{
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Saving localization target: %s"), *LocalizationTarget->Settings.Name);
-		LocalizationTarget->SaveConfig();
-		
-		// Force save all packages to ensure string table changes are persisted
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Saving all packages to persist string table changes..."));
-		
-		// Force garbage collection to ensure all string table changes are committed
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Forcing garbage collection to commit string table changes..."));
-		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Garbage collection completed"));
-		
-		// Force save all packages to ensure string table changes are persisted
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Forcing save of all packages to persist string table changes..."));
-		
-		// Note: In commandlet mode, we can't easily save packages directly
-		// The string table changes should be persisted through the localization system
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("String table changes will be persisted through the localization system"));
-		
-			// Refresh asset registry to ensure string table changes are visible
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Refreshing asset registry to make string table changes visible..."));
-			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-			AssetRegistryModule.Get().ScanModifiedAssetFiles(TArray<FString>());
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Asset registry refreshed"));
-			
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Localization target and all assets saved successfully"));
-		
-		// Run "Gather Text" to update manifest files from the updated string tables
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== RUNNING GATHER TEXT TO UPDATE MANIFEST FILES ==="));
-		UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Running gather text task to update manifest files from string tables."));
-		
-		// Generate gather config file
-		FString GatherScriptPath = LocalizationConfigurationScript::GetGatherTextConfigPath(LocalizationTarget);
-		GatherScriptPath = FConfigCacheIni::NormalizeConfigIniPath(GatherScriptPath);
-
-		LocalizationConfigurationScript::GenerateGatherTextConfigFile(LocalizationTarget).WriteWithSCC(GatherScriptPath);
-
-		const bool bUseProjectFile = !LocalizationTarget->IsMemberOfEngineTargetSet();
-
-		LocalizationCommandletExecution::FTask GatherTask(
-			LOCTEXT("GatherTaskName", "Gather Text"),
-			GatherScriptPath,
-			bUseProjectFile
-		);
-
-		// Run Gather to update manifest files from string tables
-		BlockingRunLocCommandletTask({ GatherTask });
-		
-		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Gather Text completed - manifest files updated from string tables"));
+
+		LogForJob(JobIndex, ELogVerbosity::Warning, FString::Printf(TEXT("Failed to start Task [%s] !"), *LocTask.Name.ToString()));
 	}
 }
 
-bool UGridlyImportExportCommandlet::ImportCSVToStringTable(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& CSVFilePath)
+bool UGridlyImportExportCommandlet::StartDownloadSourceChanges(const int32 JobIndex)
 {
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== ImportCSVToStringTable START ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("CSV file ready for import: %s"), *CSVFilePath);
-	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Namespace: %s, Target: %s"), *Namespace, *LocalizationTarget->Settings.Name);
+	ULocalizationTarget* LocTarget = TargetJobs[JobIndex].Target.Get();
+
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== RUNNING DOWNLOAD SOURCE CHANGES TASK ==="));
+	UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("Running Download Source Changes task for target: %s"), *LocTarget->Settings.Name);
 	
-	// Load entire CSV file (LoadFileToStringArray splits on every newline and would break values with embedded newlines)
-	FString CSVContent;
-	if (!FFileHelper::LoadFileToString(CSVContent, *CSVFilePath))
+	// Get the native culture for source strings
+	FString NativeCulture;
+	if (LocTarget->Settings.SupportedCulturesStatistics.IsValidIndex(LocTarget->Settings.NativeCultureIndex))
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Failed to read CSV file: %s"), *CSVFilePath);
-		return false;
+		const FCultureStatistics CultureStats = LocTarget->Settings.SupportedCulturesStatistics[LocTarget->Settings.NativeCultureIndex];
+		NativeCulture = CultureStats.CultureName;
 	}
-
-	// Parse into logical rows (newlines inside quoted fields are preserved as part of the value)
-	TArray<FString> CSVRows;
-	ParseCSVIntoLogicalRows(CSVContent, CSVRows);
-
-	if (CSVRows.Num() < 2) // Need at least header + 1 data row
+	else
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("⚠️ CSV file is empty or has no data rows: %s"), *CSVFilePath);
+		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("No native culture found for target: %s"), *LocTarget->Settings.Name);
 		return false;
 	}
 
-	// Parse CSV header
-	FString HeaderLine = CSVRows[0];
-	TArray<FString> HeaderFields;
-	HeaderLine.ParseIntoArray(HeaderFields, TEXT(","));
+	// The provider downloads the pages and applies them to the string tables from its Tick, completion is polled by IsTargetJobStageComplete
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔄 Running Download Source Changes..."));
+	return GridlyProvider->DownloadSourceChangesFromGridlyInternal(LocTarget, NativeCulture);
+}
 
-	if (HeaderFields.Num() < 2)
-	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Invalid CSV header format: %s"), *HeaderLine);
-		return false;
-	}
+void UGridlyImportExportCommandlet::SaveSourceChanges(const int32 JobIndex)
+{
+	ULocalizationTarget* LocTarget = TargetJobs[JobIndex].Target.Get();
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Download Source Changes completed"));
 
-	// Validate header
-	if (!HeaderFields[0].Contains(TEXT("Key")) || !HeaderFields[1].Contains(TEXT("SourceString")))
+	// Save the localization target to persist changes
+	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("💾 Saving localization target: %s"), *LocTarget->Settings.Name);
+	LocTarget->SaveConfig();
+	
+	// Save only the string tables the provider actually created or modified
+	const TArray<UStringTable*> TouchedStringTables = GridlyProvider->ConsumeTouchedStringTables();
+	if (TouchedStringTables.Num() == 0)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ CSV header must contain 'Key' and 'SourceString' columns"));
-		return false;
+		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ No string table changed, skipping package save and asset registry refresh"));
 	}
-
-	// Parse CSV data into key-value pairs (each logical row may span multiple physical lines when values contain newlines)
-	TMap<FString, FString> KeyValuePairs;
-	for (int32 i = 1; i < CSVRows.Num(); ++i)
+	else
 	{
-		const FString& Row = CSVRows[i];
-		if (Row.IsEmpty())
+		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("💾 Saving %d modified string table packages to disk..."), TouchedStringTables.Num());
+		TArray<FString> SavedFiles;
+		SaveStringTablePackages(TouchedStringTables, SavedFiles);
+
+		// Refresh asset registry for the saved files only
+		if (SavedFiles.Num() > 0)
 		{
-			continue;
+			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔄 Refreshing asset registry for %d saved string tables..."), SavedFiles.Num());
+			FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+			AssetRegistryModule.Get().ScanModifiedAssetFiles(SavedFiles);
+			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Asset registry refreshed"));
 		}
+	}
+	
+	// Run "Gather Text" to update manifest files from the updated string tables
+	TargetJobs[JobIndex].NumTouchedStringTables = TouchedStringTables.Num();
+	QueueGatherTaskIfNeeded(JobIndex);
+}
 
-		TArray<FString> Fields;
-		ParseCSVLine(Row, Fields);
+void UGridlyImportExportCommandlet::QueueGatherTaskIfNeeded(const int32 JobIndex)
+{
+	FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
+	ULocalizationTarget* LocTarget = Job.Target.Get();
 
-		if (Fields.Num() >= 2)
-		{
-			FString Key = Fields[0].TrimQuotes();
-			FString Value = Fields[1].TrimQuotes();
+	// Generate gather config file
+	FString GatherScriptPath = LocalizationConfigurationScript::GetGatherTextConfigPath(LocTarget);
+	GatherScriptPath = FConfigCacheIni::NormalizeConfigIniPath(GatherScriptPath);
+	LocalizationConfigurationScript::GenerateGatherTextConfigFile(LocTarget).WriteWithSCC(GatherScriptPath);
 
-			if (!Key.IsEmpty() && !Value.IsEmpty())
-			{
-				KeyValuePairs.Add(Key, Value);
-			}
-		}
-	}
+	const FString InputsHash = FGridlyChangeJournal::ComputeGatherInputsHash(LocTarget, GatherScriptPath);
+	const FString RecordedHash = FGridlyChangeJournal::GetRecordedHash(TEXT("Gather"), LocTarget->Settings.Name);
 
-	if (KeyValuePairs.Num() == 0)
+	FString Reason;
+	if (bForceGather)
 	{
-		UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("⚠️ No valid key-value pairs found in CSV file"));
-		return false;
+		Reason = TEXT("forced with -ForceGather");
+	}
+	else if (RecordedHash.IsEmpty())
+	{
+		Reason = TEXT("no successful gather recorded yet");
+	}
+	else if (RecordedHash != InputsHash)
+	{
+		Reason = Job.NumTouchedStringTables > 0
+			? FString::Printf(TEXT("%d string tables changed"), Job.NumTouchedStringTables)
+			: TEXT("gather inputs changed since the last successful gather");
+	}
+	else if (!FPaths::FileExists(LocalizationConfigurationScript::GetManifestPath(LocTarget)))
+	{
+		Reason = TEXT("manifest is missing");
 	}
 
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("📄 Found %d key-value pairs in CSV"), KeyValuePairs.Num());
-	
-	// Use the GridlyProvider to import the key-value pairs directly into string tables
-	// This is the same approach used by import and export operations
-	ILocalizationServiceModule& LocServiceModule = ILocalizationServiceModule::Get();
-	ILocalizationServiceProvider& LocServProvider = LocServiceModule.GetProvider();
-	
-	const bool bCanUseGridly = LocServProvider.IsEnabled() && LocServProvider.IsAvailable() && LocServProvider.GetName().ToString() == TEXT("Gridly");
-	
-	if (bCanUseGridly)
+	if (Reason.IsEmpty())
 	{
-		FGridlyLocalizationServiceProvider* GridlyProvider = static_cast<FGridlyLocalizationServiceProvider*>(&LocServProvider);
-		if (GridlyProvider)
-		{
-			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("🔄 Using GridlyProvider to import %d entries for namespace '%s'"), KeyValuePairs.Num(), *Namespace);
-			
-			// Use the provider's function directly - this is the same function that the UI uses
-			bool bSuccess = GridlyProvider->ImportKeyValuePairsToStringTable(LocalizationTarget, Namespace, KeyValuePairs);
-			
-			if (bSuccess)
-			{
-				UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Successfully imported %d entries for namespace '%s' using GridlyProvider"), 
-					KeyValuePairs.Num(), *Namespace);
-				return true;
-			}
-			else
-			{
-				UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Failed to import entries for namespace '%s' using GridlyProvider"), *Namespace);
-				return false;
-			}
-		}
+		LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("📝 Gather Text skipped for target %s: inputs unchanged since the last successful gather"),
+			*LocTarget->Settings.Name));
+		return;
 	}
-	
-	UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Could not access GridlyProvider for string table import"));
-	return false;
-}
 
-void UGridlyImportExportCommandlet::ParseCSVIntoLogicalRows(const FString& CSVContent, TArray<FString>& OutRows)
-{
-	OutRows.Empty();
-	const TCHAR QuoteChar = TEXT('"');
+	LogForJob(JobIndex, ELogVerbosity::Display, FString::Printf(TEXT("📝 Gather Text will run for target %s: %s"), *LocTarget->Settings.Name, *Reason));
 
-	bool bInsideQuotes = false;
-	FString CurrentRow;
+	Job.GatherScriptPath = GatherScriptPath;
+	Job.GatherInputsHash = InputsHash;
 
-	for (int32 i = 0; i < CSVContent.Len(); ++i)
-	{
-		const TCHAR Char = CSVContent[i];
+	const bool bUseProjectFile = !LocTarget->IsMemberOfEngineTargetSet();
+	Job.PendingLocTasks.Add(LocalizationCommandletExecution::FTask(
+		LOCTEXT("GatherTaskName", "Gather Text"),
+		GatherScriptPath,
+		bUseProjectFile
+	));
+}
 
-		if (Char == QuoteChar)
-		{
-			if (bInsideQuotes && i + 1 < CSVContent.Len() && CSVContent[i + 1] == QuoteChar)
-			{
-				CurrentRow += QuoteChar;
-				++i;
-			}
-			else
-			{
-				bInsideQuotes = !bInsideQuotes;
-				CurrentRow += Char;
-			}
-		}
-		else if (Char == TEXT('\n'))
+void UGridlyImportExportCommandlet::SaveStringTablePackages(const TArray<UStringTable*>& StringTables, TArray<FString>& OutSavedFiles)
+{
+	// Packages are serialized here while the engine writes the files in the background, all writes are awaited once at the end
+	for (UStringTable* StringTable : StringTables)
+	{
+		UPackage* Package = StringTable ? StringTable->GetPackage() : nullptr;
+		if (!Package)
 		{
-			if (!bInsideQuotes)
-			{
-				OutRows.Add(CurrentRow);
-				CurrentRow.Empty();
-			}
-			else
-			{
-				CurrentRow += Char;
-			}
+			continue;
 		}
-		else if (Char == TEXT('\r'))
+
+		// Works for newly created packages as well, they live under StringTableSavePath
+		const FString PackageName = Package->GetName();
+		const FString FilePath = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_Async;
+		if (UPackage::SavePackage(Package, StringTable, *FilePath, SaveArgs))
 		{
-			if (!bInsideQuotes)
-			{
-				if (i + 1 < CSVContent.Len() && CSVContent[i + 1] == TEXT('\n'))
-				{
-					++i;
-				}
-				OutRows.Add(CurrentRow);
-				CurrentRow.Empty();
-			}
-			else
-			{
-				CurrentRow += Char;
-			}
+			UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("✅ Successfully saved package: %s to %s"), *PackageName, *FilePath);
+			OutSavedFiles.Add(FilePath);
 		}
 		else
 		{
-			CurrentRow += Char;
+			UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("❌ Failed to save package: %s to %s"), *PackageName, *FilePath);
 		}
 	}
 
-	if (!CurrentRow.IsEmpty())
+	UPackage::WaitForAsyncFileWrites();
+}
+
+void UGridlyImportExportCommandlet::LogForJob(const int32 JobIndex, const ELogVerbosity::Type Verbosity, const FString& Message)
+{
+	if (JobIndex != LogHeadJobIndex)
 	{
-		OutRows.Add(CurrentRow);
+		TargetJobs[JobIndex].BufferedLog.Emplace(Verbosity, Message);
+		return;
+	}
+
+	switch (Verbosity)
+	{
+	case ELogVerbosity::Error:
+		UE_LOG(LogGridlyImportExportCommandlet, Error, TEXT("%s"), *Message);
+		break;
+	case ELogVerbosity::Warning:
+		UE_LOG(LogGridlyImportExportCommandlet, Warning, TEXT("%s"), *Message);
+		break;
+	case ELogVerbosity::Display:
+		UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("%s"), *Message);
+		break;
+	default:
+		UE_LOG(LogGridlyImportExportCommandlet, Log, TEXT("%s"), *Message);
+		break;
 	}
 }
 
-void UGridlyImportExportCommandlet::ParseCSVLine(const FString& Line, TArray<FString>& OutFields)
+void UGridlyImportExportCommandlet::FlushTargetJobLog(const int32 JobIndex)
 {
-	OutFields.Empty();
+	TArray<TPair<ELogVerbosity::Type, FString>> BufferedLog = MoveTemp(TargetJobs[JobIndex].BufferedLog);
+	TargetJobs[JobIndex].BufferedLog.Reset();
 
-	FString CurrentField;
-	bool bInQuotes = false;
-	
-	for (int32 i = 0; i < Line.Len(); i++)
+	for (const TPair<ELogVerbosity::Type, FString>& Entry : BufferedLog)
 	{
-		TCHAR Char = Line[i];
-		
-		if (Char == TEXT('"'))
-		{
-			if (bInQuotes && i + 1 < Line.Len() && Line[i + 1] == TEXT('"'))
-			{
-				// Escaped quote
-				CurrentField += TEXT('"');
-				i++; // Skip next quote
-			}
-			else
-			{
-				// Toggle quote state
-				bInQuotes = !bInQuotes;
-			}
-		}
-		else if (Char == TEXT(',') && !bInQuotes)
-		{
-			// Field separator
-			OutFields.Add(CurrentField);
-			CurrentField.Empty();
-		}
-		else
-		{
-			CurrentField += Char;
-		}
+		LogForJob(JobIndex, Entry.Key, Entry.Value);
 	}
-	
-	// Add the last field
-	OutFields.Add(CurrentField);
 }
 
-bool UGridlyImportExportCommandlet::UpdateStringTableEntry(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& Key, const FString& SourceString)
+
+void UGridlyImportExportCommandlet::OnDownloadComplete(const FLocalizationServiceOperationRef& Operation, ELocalizationServiceOperationCommandResult::Type Result, int32 JobIndex)
 {
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("=== UpdateStringTableEntry START ==="));
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("Target: %s, Namespace: %s, Key: %s"), 
-		*LocalizationTarget->Settings.Name, *Namespace, *Key);
-	
-	// For now, just log that we would update it
-	UE_LOG(LogGridlyImportExportCommandlet, Display, TEXT("📝 Would update string table entry: %s = %s"), *Key, *SourceString);
-	return true;
-}
+	// do like in FGridlyLocalizationServiceProvider::OnImportCultureForTargetFromGridly
+	TSharedPtr<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadLocalizationTargetOp = StaticCastSharedRef<FDownloadLocalizationTargetFile>(Operation);
+	if (!TargetJobs.IsValidIndex(JobIndex))
+	{
+		return;
+	}
+
+	FGridlyCommandletTargetJob& Job = TargetJobs[JobIndex];
+	Job.CulturesToDownload.Remove(DownloadLocalizationTargetOp->GetInLocale());
+
+	if (Result != ELocalizationServiceOperationCommandResult::Succeeded)
+	{
+		const FText ErrorMessage = DownloadLocalizationTargetOp->GetOutErrorText();
+		LogForJob(JobIndex, ELogVerbosity::Error, ErrorMessage.ToString());
+	}
 
+	const FString AbsoluteFilePathAndName = FPaths::ConvertRelativePathToFull(
+		FPaths::ProjectDir() / DownloadLocalizationTargetOp->GetInRelativeOutputFilePathAndName());
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+	Job.DownloadedFiles.Add(AbsoluteFilePathAndName);
+	if (Result == ELocalizationServiceOperationCommandResult::Succeeded)
+	{
+		Job.DownloadedCultureHashes.Add(DownloadLocalizationTargetOp->GetInLocale(), GridlyProvider->GetPoFileContentHash(AbsoluteFilePathAndName));
+	}
+}
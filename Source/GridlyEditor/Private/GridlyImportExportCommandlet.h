@@ -7,21 +7,56 @@
 #include "Commandlets/Commandlet.h"
 #include "LocalizationCommandletExecution.h"
 #include "ILocalizationServiceProvider.h"
-#include "Interfaces/IHttpRequest.h"
-#include "Interfaces/IHttpResponse.h"
-#include "HttpModule.h"
 #include "GridlyImportExportCommandlet.generated.h"
 
 // Forward declarations
 class ULocalizationTarget;
 class UStringTable;
+class FGridlyLocalizationServiceProvider;
 
-// Structure to hold Gridly source record data
-struct FGridlySourceRecord
+// Stages a localization target goes through while the commandlet pipelines several targets
+enum class EGridlyCommandletTargetStage : uint8
 {
-	FString RecordId;
-	FString SourceText;
-	FString Path;
+	Queued,
+	ImportDownload,
+	ImportTasks,
+	ExportGather,
+	ExportUpload,
+	DownloadSourceChanges,
+	SaveSourceChanges,
+	Done
+};
+
+// Per-target state, so network transfers of one target can overlap loc commandlet subprocesses of another
+struct FGridlyCommandletTargetJob
+{
+	TWeakObjectPtr<ULocalizationTarget> Target;
+	EGridlyCommandletTargetStage Stage = EGridlyCommandletTargetStage::Queued;
+	bool bStageStarted = false;
+	/** Set when a stage failed, the commandlet then exits with a non-zero code */
+	bool bFailed = false;
+
+	TArray<FString> CulturesToDownload;
+	TArray<FString> DownloadedFiles;
+
+	// Downloaded .po content per culture, recorded in the change journal for the cultures whose import succeeds
+	TMap<FString, FString> DownloadedCultureHashes;
+	TMap<FString, FString> ImportedCultureHashes;
+	FString ImportScriptPath;
+	bool bRunningImport = false;
+
+	TArray<LocalizationCommandletExecution::FTask> PendingLocTasks;
+	TSharedPtr<FLocalizationCommandletProcess> RunningLocProcess;
+	FText RunningLocTaskName;
+
+	// Gather inputs fingerprint, recorded in the change journal once the gather succeeds
+	FString GatherScriptPath;
+	FString GatherInputsHash;
+	bool bRunningGather = false;
+	int32 NumTouchedStringTables = 0;
+
+	// Output held back until every earlier target has finished, so the log reads target by target
+	TArray<TPair<ELogVerbosity::Type, FString>> BufferedLog;
 };
 
 /**
@@ -42,23 +77,37 @@ public:
 	//~ End UCommandlet Interface
 
 private:
-	TArray<FString> CulturesToDownload;
-	TArray<FString> DownloadedFiles;
+	FGridlyLocalizationServiceProvider* GridlyProvider = nullptr;
+
+	bool bDoImport = false;
+	bool bDoExport = false;
+	bool bDoDownloadSourceChanges = false;
+	bool bForceGather = false;
+	bool bForceImport = false;
 
-	// Download Source Changes functionality
-	TWeakObjectPtr<ULocalizationTarget> CurrentSourceDownloadTarget;
-	FString CurrentSourceDownloadCulture;
+	// Targets are processed in order; up to MaxConcurrentTargets of them are in flight at once
+	TArray<FGridlyCommandletTargetJob> TargetJobs;
+	int32 LogHeadJobIndex = 0;
+	int32 MaxConcurrentLocCommandlets = 1;
+	int32 RunningLocCommandlets = 0;
+	int32 NumFailedTargets = 0;
 
 private:
-	void OnDownloadComplete(const FLocalizationServiceOperationRef& Operation, ELocalizationServiceOperationCommandResult::Type Result, bool bIsTargetSet);
-	void BlockingRunLocCommandletTask(const TArray<LocalizationCommandletExecution::FTask>& LocTasks);
-	
-	// Download Source Changes methods
-	void DownloadSourceChangesFromGridlyInternal(ULocalizationTarget* LocalizationTarget, const FString& NativeCulture);
-	void OnDownloadSourceChangesFromGridly(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
-	void ProcessSourceChangesForNamespaces(const TMap<FString, TArray<FGridlySourceRecord>>& NamespaceRecords);
-	bool ImportCSVToStringTable(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& CSVFilePath);
-	void ParseCSVIntoLogicalRows(const FString& CSVContent, TArray<FString>& OutRows);
-	void ParseCSVLine(const FString& Line, TArray<FString>& OutFields);
-	bool UpdateStringTableEntry(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& Key, const FString& SourceString);
+	void OnDownloadComplete(const FLocalizationServiceOperationRef& Operation, ELocalizationServiceOperationCommandResult::Type Result, int32 JobIndex);
+
+	// Target pipeline
+	/** Returns false if an engine exit, such as from Ctrl-C, cancelled the remaining work */
+	bool RunTargetPipeline(int32 MaxConcurrentTargets);
+	void TickTargetJob(int32 JobIndex);
+	bool StartTargetJobStage(int32 JobIndex);
+	bool IsTargetJobStageComplete(int32 JobIndex) const;
+	EGridlyCommandletTargetStage GetNextStage(EGridlyCommandletTargetStage Stage) const;
+	bool TickLocCommandletTasks(int32 JobIndex);
+	/** Returns false if the download could not be started */
+	bool StartDownloadSourceChanges(int32 JobIndex);
+	void SaveSourceChanges(int32 JobIndex);
+	void QueueGatherTaskIfNeeded(int32 JobIndex);
+	void SaveStringTablePackages(const TArray<UStringTable*>& StringTables, TArray<FString>& OutSavedFiles);
+	void LogForJob(int32 JobIndex, ELogVerbosity::Type Verbosity, const FString& Message);
+	void FlushTargetJobLog(int32 JobIndex);
 };
\ No newline at end of file
@@ -2,27 +2,35 @@
 
 #include "GridlyLocalizationServiceProvider.h"
 
+#include "GridlyApi.h"
+#include "GridlyBackgroundJob.h"
+#include "GridlyBatchSizer.h"
+#include "GridlyChangeJournal.h"
+#include "GridlyDownloadCheckpoint.h"
 #include "GridlyEditor.h"
 #include "GridlyExporter.h"
 #include "GridlyGameSettings.h"
 #include "GridlyLocalizedText.h"
 #include "GridlyLocalizedTextConverter.h"
+#include "GridlyStats.h"
 #include "GridlyStyle.h"
 #include "GridlyTask_DownloadLocalizedTexts.h"
 #include "HttpModule.h"
 #include "ILocalizationServiceModule.h"
+#include "Async/Async.h"
+#include "LocalizationCommandletExecution.h"
 #include "LocalizationCommandletTasks.h"
 #include "LocalizationModule.h"
 #include "LocalizationTargetTypes.h"
 #include "Interfaces/IHttpResponse.h"
-#include "Interfaces/IMainFrameModule.h"
 #include "Internationalization/Culture.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Misc/FeedbackContext.h"
-#include "Misc/ScopedSlowTask.h"
 #include "Serialization/JsonSerializer.h"
 #include "Styling/AppStyle.h"
 #include <filesystem>
 #include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformFilemanager.h"
 #include "GridlyCultureConverter.h"
 #include "LocalizationConfigurationScript.h"
@@ -159,48 +167,164 @@ ELocalizationServiceOperationCommandResult::Type FGridlyLocalizationServiceProvi
 {
 	const TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadOperation =
 		StaticCastSharedRef<FDownloadLocalizationTargetFile>(InOperation);
-	const FString TargetCulture = DownloadOperation->GetInLocale();
 
+	ExecuteDownloads({ DownloadOperation }, InOperationCompleteDelegate);
+
+	return ELocalizationServiceOperationCommandResult::Succeeded;
+}
+
+void FGridlyLocalizationServiceProvider::ExecuteDownloads(
+	const TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>>& DownloadOperations,
+	const FLocalizationServiceOperationComplete& InOperationCompleteDelegate)
+{
 	UGridlyTask_DownloadLocalizedTexts* Task = UGridlyTask_DownloadLocalizedTexts::DownloadLocalizedTexts(nullptr);
 
+	const FGridlyCancellationToken DownloadCancellationToken = CancellationToken;
+	Task->CancellationToken = DownloadCancellationToken;
+	if (DownloadOperations.Num() > 0)
+	{
+		Task->CheckpointKey = DownloadOperations[0]->GetInTargetGuid().ToString(EGuidFormats::Digits);
+	}
+	ActiveDownloads.Add({ Task, DownloadOperations });
+	const TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts> WeakTask = Task;
+
 	// On success
-	Task->OnSuccessDelegate.BindLambda(
-		[this, DownloadOperation, InOperationCompleteDelegate, TargetCulture](const TArray<FPolyglotTextData>& PolyglotTextDatas)
+	Task->OnRecordStoreSuccessDelegate.BindLambda(
+		[this, WeakTask, DownloadCancellationToken, DownloadOperations, InOperationCompleteDelegate](FGridlyTextRecordStore& TextRecords)
 		{
-			/*
-			if (PolyglotTextDatas.Num() > 0)
-			{
-			*/
-			const FString AbsoluteFilePathAndName = FPaths::ConvertRelativePathToFull(
-				FPaths::ProjectDir() / DownloadOperation->GetInRelativeOutputFilePathAndName());
+			ActiveDownloads.RemoveAll([&WeakTask](const FActiveDownload& ActiveDownload) { return ActiveDownload.Task == WeakTask; });
 
-			bool writeProc = FGridlyLocalizedTextConverter::WritePoFile(PolyglotTextDatas, TargetCulture, AbsoluteFilePathAndName);
-			// Callback for successful write
-			InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Succeeded);
-			/*
+			TArray<FString> TargetCultures;
+			TArray<FString> AbsoluteFilePathAndNames;
+			for (const auto& DownloadOperation : DownloadOperations)
+			{
+				TargetCultures.Add(DownloadOperation->GetInLocale());
+				AbsoluteFilePathAndNames.Add(FPaths::ConvertRelativePathToFull(
+					FPaths::ProjectDir() / DownloadOperation->GetInRelativeOutputFilePathAndName()));
 			}
-			else
+
+			// Every culture is written from the same download, so the files can be written in parallel
+			if (IsRunningCommandlet())
 			{
-				// Handle parse failure
-				DownloadOperation->SetOutErrorText(LOCTEXT("GridlyErrorParse", "Failed to parse downloaded content"));
-				InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Failed);
+				TArray<bool> WriteResults;
+				TArray<FString> ContentHashes;
+				FGridlyLocalizedTextConverter::WritePoFiles(TextRecords, TargetCultures, AbsoluteFilePathAndNames, WriteResults,
+					&ContentHashes, &DownloadCancellationToken);
+				CompleteDownloads(DownloadOperations, InOperationCompleteDelegate, AbsoluteFilePathAndNames, WriteResults, ContentHashes,
+					DownloadCancellationToken);
+				return;
 			}
-			*/
+
+			// In the editor the files are written on a worker thread, and only the operations are completed on the game thread
+			const TSharedRef<FGridlyTextRecordStore> Records = MakeShared<FGridlyTextRecordStore>(MoveTemp(TextRecords));
+			Async(EAsyncExecution::ThreadPool,
+				[this, Records, TargetCultures = MoveTemp(TargetCultures), AbsoluteFilePathAndNames = MoveTemp(AbsoluteFilePathAndNames),
+				DownloadCancellationToken, DownloadOperations, InOperationCompleteDelegate]()
+				{
+					TArray<bool> WriteResults;
+					TArray<FString> ContentHashes;
+					FGridlyLocalizedTextConverter::WritePoFiles(*Records, TargetCultures, AbsoluteFilePathAndNames, WriteResults,
+						&ContentHashes, &DownloadCancellationToken);
+
+					AsyncTask(ENamedThreads::GameThread,
+						[this, AbsoluteFilePathAndNames, WriteResults = MoveTemp(WriteResults), ContentHashes = MoveTemp(ContentHashes),
+						DownloadCancellationToken, DownloadOperations, InOperationCompleteDelegate]()
+						{
+							CompleteDownloads(DownloadOperations, InOperationCompleteDelegate, AbsoluteFilePathAndNames, WriteResults,
+								ContentHashes, DownloadCancellationToken);
+						});
+				});
 		});
 
 	// On fail
 	Task->OnFailDelegate.BindLambda(
-		[DownloadOperation, InOperationCompleteDelegate](const TArray<FPolyglotTextData>& PolyglotTextDatas, const FGridlyResult& Error)
+		[this, WeakTask, DownloadOperations, InOperationCompleteDelegate](const TArray<FPolyglotTextData>& PolyglotTextDatas,
+		const FGridlyResult& Error)
 		{
+			ActiveDownloads.RemoveAll([&WeakTask](const FActiveDownload& ActiveDownload) { return ActiveDownload.Task == WeakTask; });
+
 			// Handle download failure
-			DownloadOperation->SetOutErrorText(FText::FromString(Error.Message));
-			InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Failed);
+			for (const auto& DownloadOperation : DownloadOperations)
+			{
+				DownloadOperation->SetOutErrorText(FText::FromString(Error.Message));
+				InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Failed);
+			}
 		});
 
 	// Activate the task
 	Task->Activate();
+}
 
-	return ELocalizationServiceOperationCommandResult::Succeeded;
+void FGridlyLocalizationServiceProvider::CompleteDownloads(
+	const TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>>& DownloadOperations,
+	const FLocalizationServiceOperationComplete& InOperationCompleteDelegate, const TArray<FString>& AbsoluteFilePathAndNames,
+	const TArray<bool>& WriteResults, const TArray<FString>& ContentHashes, const FGridlyCancellationToken& DownloadCancellationToken)
+{
+	for (int32 i = 0; i < AbsoluteFilePathAndNames.Num(); i++)
+	{
+		PoFileContentHashes.Add(AbsoluteFilePathAndNames[i], ContentHashes[i]);
+	}
+
+	for (int32 i = 0; i < DownloadOperations.Num(); i++)
+	{
+		const auto& DownloadOperation = DownloadOperations[i];
+
+		// Cancelled while the files were written
+		if (DownloadCancellationToken.IsCancelled())
+		{
+			DownloadOperation->SetOutErrorText(LOCTEXT("GridlyDownloadCancelled", "Download was cancelled"));
+			InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Failed);
+		}
+		else if (!WriteResults[i])
+		{
+			DownloadOperation->SetOutErrorText(FText::Format(LOCTEXT("GridlyPoWriteFailed", "Failed to write {0}"),
+				FText::FromString(AbsoluteFilePathAndNames[i])));
+			InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Failed);
+		}
+		else
+		{
+			InOperationCompleteDelegate.Execute(DownloadOperation, ELocalizationServiceOperationCommandResult::Succeeded);
+		}
+	}
+}
+
+FString FGridlyLocalizationServiceProvider::GenerateImportTextConfigFile(ULocalizationTarget* LocalizationTarget,
+	const FString& DirectoryPath, const TArray<FString>& ExcludedCultures)
+{
+	FString ImportScriptPath = LocalizationConfigurationScript::GetImportTextConfigPath(LocalizationTarget, TOptional<FString>());
+	ImportScriptPath = FConfigCacheIni::NormalizeConfigIniPath(ImportScriptPath);
+
+	FLocalizationConfigurationScript ImportScript =
+		LocalizationConfigurationScript::GenerateImportTextConfigFile(LocalizationTarget, TOptional<FString>(), DirectoryPath);
+	if (ExcludedCultures.Num() > 0)
+	{
+		TArray<FString> CulturesToGenerate;
+		ImportScript.GetArray(TEXT("CommonSettings"), TEXT("CulturesToGenerate"), CulturesToGenerate);
+		CulturesToGenerate.RemoveAll([&ExcludedCultures](const FString& Culture)
+		{
+			return ExcludedCultures.Contains(Culture);
+		});
+		ImportScript.SetArray(TEXT("CommonSettings"), TEXT("CulturesToGenerate"), CulturesToGenerate);
+	}
+	ImportScript.WriteWithSCC(ImportScriptPath);
+
+	return ImportScriptPath;
+}
+
+TArray<FString> FGridlyLocalizationServiceProvider::GetCulturesExcludedFromImport(const ULocalizationTarget* LocalizationTarget,
+	const TMap<FString, FString>& CulturesToImport)
+{
+	TArray<FString> ExcludedCultures;
+	for (int32 i = 0; i < LocalizationTarget->Settings.SupportedCulturesStatistics.Num(); i++)
+	{
+		const FString& CultureName = LocalizationTarget->Settings.SupportedCulturesStatistics[i].CultureName;
+		if (i != LocalizationTarget->Settings.NativeCultureIndex && !CulturesToImport.Contains(CultureName))
+		{
+			ExcludedCultures.Add(CultureName);
+		}
+	}
+
+	return ExcludedCultures;
 }
 
 
@@ -208,16 +332,119 @@ ELocalizationServiceOperationCommandResult::Type FGridlyLocalizationServiceProvi
 bool FGridlyLocalizationServiceProvider::CanCancelOperation(
 	const TSharedRef<ILocalizationServiceOperation, ESPMode::ThreadSafe>& InOperation) const
 {
-	return false;
+	return FindActiveDownload(*InOperation) != INDEX_NONE;
 }
 
 void FGridlyLocalizationServiceProvider::CancelOperation(
 	const TSharedRef<ILocalizationServiceOperation, ESPMode::ThreadSafe>& InOperation)
 {
+	const int32 DownloadIndex = FindActiveDownload(*InOperation);
+	if (DownloadIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// One download serves every operation it was started with, so all of them fail
+	const TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts> Task = ActiveDownloads[DownloadIndex].Task;
+	ActiveDownloads.RemoveAt(DownloadIndex);
+	if (Task.IsValid())
+	{
+		Task->Cancel();
+	}
+}
+
+int32 FGridlyLocalizationServiceProvider::FindActiveDownload(const ILocalizationServiceOperation& Operation) const
+{
+	return ActiveDownloads.IndexOfByPredicate([&Operation](const FActiveDownload& ActiveDownload)
+	{
+		return ActiveDownload.Task.IsValid() && ActiveDownload.Operations.ContainsByPredicate(
+			[&Operation](const TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>& DownloadOperation)
+			{
+				return &DownloadOperation.Get() == &Operation;
+			});
+	});
 }
 
 void FGridlyLocalizationServiceProvider::Tick()
 {
+	TickImportTasks();
+	TickApplySourceChanges();
+}
+
+namespace GridlyCancellation
+{
+	/** Cancels a request without running its completion delegate */
+	static void AbortRequest(FHttpRequestPtr& Request)
+	{
+		if (Request.IsValid())
+		{
+			Request->OnProcessRequestComplete().Unbind();
+			Request->CancelRequest();
+			Request.Reset();
+		}
+	}
+}
+
+void FGridlyLocalizationServiceProvider::CancelAll()
+{
+	UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("🛑 Cancelling Gridly work in flight"));
+
+	// Work started from here on gets a fresh token
+	CancellationToken.Cancel();
+	CancellationToken = FGridlyCancellationToken();
+
+	TGuardValue<bool> CancellingGuard(bCancelling, true);
+
+	// Downloads, whose operations fail through the usual delegate
+	const TArray<FActiveDownload> Downloads = MoveTemp(ActiveDownloads);
+	ActiveDownloads.Reset();
+	for (const FActiveDownload& Download : Downloads)
+	{
+		if (UGridlyTask_DownloadLocalizedTexts* Task = Download.Task.Get())
+		{
+			Task->Cancel();
+		}
+	}
+
+	// Export queue
+	ExportFromTargetRequestQueue.Empty();
+	GridlyCancellation::AbortRequest(CurrentExportRequest);
+	bExportRequestInProgress = false;
+
+	// Sync and its delete batches
+	for (FHttpRequestPtr& Request : PendingSyncRequests)
+	{
+		GridlyCancellation::AbortRequest(Request);
+	}
+	PendingSyncRequests.Reset();
+	bHasDeletesPending = false;
+
+	// Source changes, the checkpointed pages are kept so the download can resume
+	GridlyCancellation::AbortRequest(CurrentSourceDownloadRequest);
+	if (bSourceDownloadInProgress || PendingSourceChangeNamespaces.Num() > 0)
+	{
+		bSourceDownloadFailed = true;
+	}
+	bSourceDownloadInProgress = false;
+	bVerifySourceDownloadCheckpoint = false;
+	AccumulatedSourceDownloadNamespaceRecords.Reset();
+	AccumulatedSourceDownloadBytes = 0;
+	SpilledSourceDownloadNamespaces.Reset();
+	PendingSourceChangeNamespaces.Reset();
+
+	// Import commandlets, releasing the process terminates it
+	PendingImportTasks.Reset();
+	RunningImportProcess.Reset();
+
+	const FText CancelledText = LOCTEXT("GridlyJobCancelled", "Cancelled");
+	for (TSharedPtr<FGridlyBackgroundJob>* Job : { &ImportJob, &ExportJob, &SyncJob, &SourceChangesJob })
+	{
+		if (Job->IsValid())
+		{
+			(*Job)->Fail(CancelledText);
+			Job->Reset();
+		}
+	}
 }
 
 #if LOCALIZATION_SERVICES_WITH_SLATE
@@ -319,16 +546,16 @@ void FGridlyLocalizationServiceProvider::ImportAllCulturesForTargetFromGridly(
 
 		CurrentCultureDownloads.Append(Cultures);
 		SuccessfulDownloads = 0;
+		DownloadedCultureHashes.Reset();
 
-		const float AmountOfWork = CurrentCultureDownloads.Num();
-		ImportAllCulturesForTargetFromGridlySlowTask = MakeShareable(new FScopedSlowTask(AmountOfWork,
-			LOCTEXT("ImportAllCulturesForTargetFromGridlyText", "Importing all cultures for target from Gridly")));
-
-		ImportAllCulturesForTargetFromGridlySlowTask->MakeDialog();
+		ImportJob = MakeShared<FGridlyBackgroundJob>(
+			LOCTEXT("ImportAllCulturesForTargetFromGridlyText", "Importing all cultures for target from Gridly"),
+			FSimpleDelegate::CreateRaw(this, &FGridlyLocalizationServiceProvider::CancelAll));
+		ImportJob->SetProgress(LOCTEXT("GridlyImportDownloading", "Downloading translations"));
 
+		TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>> DownloadOperations;
 		for (const FString& CultureName : Cultures)
 		{
-			ILocalizationServiceProvider& Provider = ILocalizationServiceModule::Get().GetProvider();
 			TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe> DownloadTargetFileOp =
 				ILocalizationServiceOperation::Create<FDownloadLocalizationTargetFile>();
 			DownloadTargetFileOp->SetInTargetGuid(LocalizationTarget->Settings.Guid);
@@ -348,20 +575,30 @@ void FGridlyLocalizationServiceProvider::ImportAllCulturesForTargetFromGridly(
 				{
 					PlatformFile.DeleteFile(*Path);
 					UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("Deleted empty file: %s"), *Path);
+					CurrentCultureDownloads.Remove(CultureName);
 					continue;
 				}
 			}
 
+			// A .po file left over from an earlier run must not stand in for a download that fails
+			IFileManager::Get().Delete(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Path), false, false, true);
+
+			DownloadOperations.Add(DownloadTargetFileOp);
+		}
+
+		// One download serves every culture
+		if (DownloadOperations.Num() > 0)
+		{
 			auto OperationCompleteDelegate = FLocalizationServiceOperationComplete::CreateRaw(this,
 				&FGridlyLocalizationServiceProvider::OnImportCultureForTargetFromGridly, bIsTargetSet);
 
-			Provider.Execute(DownloadTargetFileOp, TArray<FLocalizationServiceTranslationIdentifier>(),
-				ELocalizationServiceOperationConcurrency::Synchronous, OperationCompleteDelegate);
-
-			ImportAllCulturesForTargetFromGridlySlowTask->EnterProgressFrame(1.f);
+			ExecuteDownloads(DownloadOperations, OperationCompleteDelegate);
+		}
+		else
+		{
+			ImportJob->Complete(LOCTEXT("GridlyImportNothingToDownload", "No cultures to download"));
+			ImportJob.Reset();
 		}
-
-		ImportAllCulturesForTargetFromGridlySlowTask.Reset();
 	}
 }
 
@@ -380,12 +617,30 @@ void FGridlyLocalizationServiceProvider::OnImportCultureForTargetFromGridly(cons
 	if (Result == ELocalizationServiceOperationCommandResult::Succeeded)
 	{
 		SuccessfulDownloads++;
+		DownloadedCultureHashes.Add(DownloadLocalizationTargetOp->GetInLocale(), GetPoFileContentHash(FPaths::ConvertRelativePathToFull(
+			FPaths::ProjectDir() / DownloadLocalizationTargetOp->GetInRelativeOutputFilePathAndName())));
 	}
 	else
 	{
 		const FText ErrorMessage = DownloadLocalizationTargetOp->GetOutErrorText();
-		UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorMessage.ToString());
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ErrorMessage.ToString()));
+		if (bCancelling)
+		{
+			UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *ErrorMessage.ToString());
+		}
+		else
+		{
+			UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorMessage.ToString());
+			if (ImportJob.IsValid())
+			{
+				ImportJob->AddMessage(EMessageSeverity::Error, ErrorMessage);
+			}
+		}
+	}
+
+	if (CurrentCultureDownloads.Num() == 0 && SuccessfulDownloads == 0 && ImportJob.IsValid() && !bCancelling)
+	{
+		ImportJob->Fail(LOCTEXT("GridlyImportDownloadFailed", "Failed to download translations from Gridly"));
+		ImportJob.Reset();
 	}
 
 	if (CurrentCultureDownloads.Num() == 0 && SuccessfulDownloads > 0)
@@ -398,47 +653,179 @@ void FGridlyLocalizationServiceProvider::OnImportCultureForTargetFromGridly(cons
 
 		UE_LOG(LogGridlyEditor, Log, TEXT("Loading from file: %s"), *AbsoluteFilePathAndName);
 
-		IMainFrameModule& MainFrameModule = FModuleManager::LoadModuleChecked<IMainFrameModule>(TEXT("MainFrame"));
-		const TSharedPtr<SWindow>& MainFrameParentWindow = MainFrameModule.GetParentWindow();
+		// Cultures whose .po content matches the last successful import are left out of the import
+		const TArray<FString> ChangedCultures = FGridlyChangeJournal::GetChangedImportCultures(Target, DownloadedCultureHashes);
+		if (ChangedCultures.Num() == 0)
+		{
+			UE_LOG(LogGridlyEditor, Log, TEXT("Translations of target %s are unchanged since the last import, skipping import"), *TargetName);
+			if (ImportJob.IsValid())
+			{
+				ImportJob->Complete(LOCTEXT("GridlyImportUnchanged", "Translations are unchanged since the last import, nothing to import."));
+				ImportJob.Reset();
+			}
+		}
+		else if (!bIsTargetSet)
+		{
+			TArray<FString> UnchangedCultures;
+			TMap<FString, FString> ChangedCultureHashes;
+			for (const TPair<FString, FString>& CultureHash : DownloadedCultureHashes)
+			{
+				if (ChangedCultures.Contains(CultureHash.Key))
+				{
+					ChangedCultureHashes.Add(CultureHash);
+				}
+				else
+				{
+					UnchangedCultures.Add(CultureHash.Key);
+				}
+			}
+
+			UE_LOG(LogGridlyEditor, Log, TEXT("Importing %d changed cultures of target %s, %d unchanged"), ChangedCultures.Num(), *TargetName,
+				UnchangedCultures.Num());
+
+			// Same tasks as LocalizationCommandletTasks::ImportTextForTarget, with the unchanged cultures left out
+			const bool bShouldUseProjectFile = !Target->IsMemberOfEngineTargetSet();
+			TArray<LocalizationCommandletExecution::FTask> Tasks;
+
+			const FString ImportScriptPath = GenerateImportTextConfigFile(Target, FPaths::GetPath(FPaths::GetPath(AbsoluteFilePathAndName)),
+				GetCulturesExcludedFromImport(Target, ChangedCultureHashes));
+			Tasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ImportTaskName", "Import Translations"), ImportScriptPath, bShouldUseProjectFile));
+
+			const FString ReportScriptPath = LocalizationConfigurationScript::GetWordCountReportConfigPath(Target);
+			LocalizationConfigurationScript::GenerateWordCountReportConfigFile(Target).WriteWithSCC(ReportScriptPath);
+			Tasks.Add(LocalizationCommandletExecution::FTask(LOCTEXT("ReportTaskName", "Generate Reports"), ReportScriptPath, bShouldUseProjectFile));
+
+			// The commandlets run one after another from Tick instead of in the modal commandlet window
+			PendingImportTasks = MoveTemp(Tasks);
+			ImportTasksScriptPath = ImportScriptPath;
+			ImportTasksTarget = Target;
+			ImportTasksCultureHashes = MoveTemp(ChangedCultureHashes);
+			bImportTasksFailed = false;
+		}
+	}
+}
 
-		if (!bIsTargetSet)
+void FGridlyLocalizationServiceProvider::TickImportTasks()
+{
+	if (RunningImportProcess.IsValid())
+	{
+		// Same as FCommandletLogPump, one read per tick
+		const FString PipeString = FPlatformProcess::ReadPipe(RunningImportProcess->GetReadPipe());
+		if (!PipeString.IsEmpty())
 		{
+			UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *PipeString);
+		}
 
-			//here we call the gather
-			LocalizationCommandletTasks::ImportTextForTarget(MainFrameParentWindow.ToSharedRef(), Target,
-				FPaths::GetPath(FPaths::GetPath(AbsoluteFilePathAndName)));
+		FProcHandle ProcessHandle = RunningImportProcess->GetHandle();
+		if (FPlatformProcess::IsProcRunning(ProcessHandle) || !PipeString.IsEmpty())
+		{
+			return;
+		}
 
-			Target->UpdateWordCountsFromCSV();
-			Target->UpdateStatusFromConflictReport();
+		int32 ReturnCode = INDEX_NONE;
+		if (ProcessHandle.IsValid() && FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode))
+		{
+			UE_LOG(LogGridlyEditor, Log, TEXT("%s returned %d"), *RunningImportTaskName.ToString(), ReturnCode);
+		}
+		RunningImportProcess.Reset();
 
+		if (ReturnCode != 0)
+		{
+			bImportTasksFailed = true;
+			if (ImportJob.IsValid())
+			{
+				ImportJob->AddMessage(EMessageSeverity::Error, FText::Format(LOCTEXT("GridlyImportTaskFailed",
+					"{0} failed with return code {1}"), RunningImportTaskName, ReturnCode));
+			}
+		}
+		else if (RunningImportTaskScriptPath == ImportTasksScriptPath && ImportTasksTarget.IsValid())
+		{
+			FGridlyChangeJournal::RecordImportedCultures(ImportTasksTarget.Get(), ImportTasksCultureHashes);
+		}
+
+		if (PendingImportTasks.Num() == 0)
+		{
+			FinishImportTasks();
+			return;
+		}
+	}
+
+	if (PendingImportTasks.Num() == 0)
+	{
+		return;
+	}
+
+	const LocalizationCommandletExecution::FTask Task = PendingImportTasks[0];
+	PendingImportTasks.RemoveAt(0);
+
+	RunningImportProcess = FLocalizationCommandletProcess::Execute(Task.ScriptPath, Task.ShouldUseProjectFile);
+	if (!RunningImportProcess.IsValid())
+	{
+		UE_LOG(LogGridlyEditor, Error, TEXT("Failed to start %s"), *Task.Name.ToString());
+		bImportTasksFailed = true;
+		PendingImportTasks.Reset();
+		FinishImportTasks();
+		return;
+	}
+
+	RunningImportTaskName = Task.Name;
+	RunningImportTaskScriptPath = Task.ScriptPath;
+	if (ImportJob.IsValid())
+	{
+		ImportJob->SetProgress(Task.Name);
+	}
+}
 
+void FGridlyLocalizationServiceProvider::FinishImportTasks()
+{
+	if (ULocalizationTarget* Target = ImportTasksTarget.Get())
+	{
+		Target->UpdateWordCountsFromCSV();
+		Target->UpdateStatusFromConflictReport();
+	}
 
+	if (ImportJob.IsValid())
+	{
+		if (bImportTasksFailed)
+		{
+			ImportJob->Fail(LOCTEXT("GridlyImportTasksFailed", "Importing translations failed, see the output log"));
 		}
+		else
+		{
+			ImportJob->Complete(FText::Format(LOCTEXT("GridlyImportTasksSucceeded", "Imported {0} changed cultures"),
+				ImportTasksCultureHashes.Num()));
+		}
+		ImportJob.Reset();
 	}
+
+	ImportTasksTarget.Reset();
+	ImportTasksCultureHashes.Reset();
 }
 
-TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateExportRequest(const TArray<FPolyglotTextData>& PolyglotTextDatas,
-	const TSharedPtr<FLocTextHelper>& LocTextHelperPtr, bool bIncludeTargetTranslations)
+FString CreateExportPayload(const TArray<FPolyglotTextData>& PolyglotTextDatas, const TSharedPtr<FLocTextHelper>& LocTextHelperPtr,
+	bool bIncludeTargetTranslations)
 {
 	FString JsonString;
-	FGridlyExporter::ConvertToJson(PolyglotTextDatas, bIncludeTargetTranslations, LocTextHelperPtr, JsonString);
+	{
+		GRIDLY_PERF_SCOPE(Export, Convert);
+		FGridlyExporter::ConvertToJson(PolyglotTextDatas, bIncludeTargetTranslations, LocTextHelperPtr, JsonString);
+	}
+	FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::Export, PolyglotTextDatas.Num());
 	UE_LOG(LogGridlyEditor, Log, TEXT("Creating export request with %d entries"), PolyglotTextDatas.Num());
 
+	return JsonString;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateExportRequest(const FString& JsonString)
+{
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 	const FString ApiKey = GameSettings->ExportApiKey;
 	const FString ViewId = GameSettings->ExportViewId;
 
-	FStringFormatNamedArguments Args;
-	Args.Add(TEXT("ViewId"), *ViewId);
-	const FString Url = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/records"), Args);
+	const FString Url = FGridlyApi::GetViewUrl(ViewId, TEXT("records"));
 
-	auto HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-	HttpRequest->SetContentAsString(JsonString);
-	HttpRequest->SetVerb(TEXT("POST"));
-	HttpRequest->SetURL(Url);
+	auto HttpRequest = FGridlyApi::CreateRequest(TEXT("POST"), Url, ApiKey);
+	FGridlyApi::SetContent(HttpRequest, JsonString);
 
 	return HttpRequest;
 }
@@ -460,16 +847,20 @@ void FGridlyLocalizationServiceProvider::ExportNativeCultureForTargetToGridly(
 			FHttpRequestCompleteDelegate ReqDelegate = FHttpRequestCompleteDelegate::CreateRaw(this,
 				&FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly);
 
-			const FText SlowTaskText = LOCTEXT("ExportNativeCultureForTargetToGridlyText",
+			const FText JobTitle = LOCTEXT("ExportNativeCultureForTargetToGridlyText",
 				"Exporting native culture for target to Gridly");
 
-			ExportForTargetToGridly(InLocalizationTarget, ReqDelegate, SlowTaskText);
+			ExportForTargetToGridly(InLocalizationTarget, ReqDelegate, JobTitle);
 		}
 	}
 }
 
 void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bSuccess)
 {
+	GRIDLY_PERF_HTTP(Export, HttpRequestPtr, HttpResponsePtr);
+
+	CurrentExportRequest.Reset();
+
 	UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 
 	const bool bSyncRecords = GameSettings->bSyncRecords;
@@ -478,11 +869,16 @@ void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(
 		if (HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Ok || HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Created)
 		{
 			// Success: process the response and log the result
-			const FString Content = HttpResponsePtr->GetContentAsString();
+			const FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 			const auto JsonStringReader = TJsonReaderFactory<TCHAR>::Create(Content);
 			TArray<TSharedPtr<FJsonValue>> JsonValueArray;
 			FJsonSerializer::Deserialize(JsonStringReader, JsonValueArray);
 			ExportForTargetEntriesUpdated += JsonValueArray.Num();
+			if (ExportJob.IsValid())
+			{
+				ExportJob->SetProgress(FText::Format(LOCTEXT("GridlyExportProgress", "{0} entries updated"),
+					FText::AsNumber(static_cast<uint64>(ExportForTargetEntriesUpdated))));
+			}
 
 			// Continue processing or log success...
 
@@ -490,7 +886,8 @@ void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(
 			TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> NextRequest;
 			if (ExportFromTargetRequestQueue.Dequeue(NextRequest))
 			{
-				NextRequest->ProcessRequest();
+				CurrentExportRequest = NextRequest;
+				FGridlyApi::ProcessRequest(NextRequest.ToSharedRef());
 			}
 			else
 			{
@@ -499,14 +896,11 @@ void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(
 					FetchGridlyCSV();
 				}
 
-				if (!IsRunningCommandlet())
+				if (ExportJob.IsValid())
 				{
-					FString Message = FString::Printf(TEXT("Number of entries updated: %llu"),
-						ExportForTargetEntriesUpdated);  // Include deleted records
-
-					UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *Message);
-					FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
-					ExportForTargetToGridlySlowTask.Reset();
+					const FString Message = FString::Printf(TEXT("Number of entries updated: %llu"), ExportForTargetEntriesUpdated);
+					ExportJob->Complete(FText::FromString(Message));
+					ExportJob.Reset();
 				}
 
 				bExportRequestInProgress = false;
@@ -516,14 +910,14 @@ void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(
 		else
 		{
 			// Handle HTTP error
-			const FString Content = HttpResponsePtr->GetContentAsString();
+			const FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 			const FString ErrorReason = FString::Printf(TEXT("Error: %d, reason: %s"), HttpResponsePtr->GetResponseCode(), *Content);
 			UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorReason);
 
-			if (!IsRunningCommandlet())
+			if (ExportJob.IsValid())
 			{
-				FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ErrorReason));
-				ExportForTargetToGridlySlowTask.Reset();
+				ExportJob->Fail(FText::FromString(ErrorReason));
+				ExportJob.Reset();
 			}
 
 			bExportRequestInProgress = false;
@@ -532,10 +926,10 @@ void FGridlyLocalizationServiceProvider::OnExportNativeCultureForTargetToGridly(
 	else
 	{
 		// Handle failure
-		if (!IsRunningCommandlet())
+		if (ExportJob.IsValid())
 		{
-			FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("GridlyConnectionError", "ERROR: Unable to connect to Gridly"));
-			ExportForTargetToGridlySlowTask.Reset();
+			ExportJob->Fail(LOCTEXT("GridlyConnectionError", "ERROR: Unable to connect to Gridly"));
+			ExportJob.Reset();
 		}
 
 		bExportRequestInProgress = false;
@@ -563,26 +957,35 @@ void FGridlyLocalizationServiceProvider::ExportTranslationsForTargetToGridly(TWe
 			FHttpRequestCompleteDelegate ReqDelegate = FHttpRequestCompleteDelegate::CreateRaw(this,
 				&FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly);
 
-			const FText SlowTaskText = LOCTEXT("ExportTranslationsForTargetToGridlyText",
+			const FText JobTitle = LOCTEXT("ExportTranslationsForTargetToGridlyText",
 				"Exporting source text and translations for target to Gridly");
 
-			ExportForTargetToGridly(InLocalizationTarget, ReqDelegate, SlowTaskText, true);
+			ExportForTargetToGridly(InLocalizationTarget, ReqDelegate, JobTitle, true);
 		}
 	}
 }
 
 void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bSuccess)
 {
+	GRIDLY_PERF_HTTP(Export, HttpRequestPtr, HttpResponsePtr);
+
+	CurrentExportRequest.Reset();
+
 	if (bSuccess)
 	{
 		if (HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Ok || HttpResponsePtr->GetResponseCode() == EHttpResponseCodes::Created)
 		{
 			// Success: process the response
-			const FString Content = HttpResponsePtr->GetContentAsString();
+			const FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 			const auto JsonStringReader = TJsonReaderFactory<TCHAR>::Create(Content);
 			TArray<TSharedPtr<FJsonValue>> JsonValueArray;
 			FJsonSerializer::Deserialize(JsonStringReader, JsonValueArray);
 			ExportForTargetEntriesUpdated += JsonValueArray.Num();
+			if (ExportJob.IsValid())
+			{
+				ExportJob->SetProgress(FText::Format(LOCTEXT("GridlyExportProgress", "{0} entries updated"),
+					FText::AsNumber(static_cast<uint64>(ExportForTargetEntriesUpdated))));
+			}
 
 			// Continue processing or log success...
 
@@ -590,7 +993,8 @@ void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(F
 			TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> NextRequest;
 			if (ExportFromTargetRequestQueue.Dequeue(NextRequest))
 			{
-				NextRequest->ProcessRequest();
+				CurrentExportRequest = NextRequest;
+				FGridlyApi::ProcessRequest(NextRequest.ToSharedRef());
 			}
 			else
 			{
@@ -598,10 +1002,10 @@ void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(F
 				const FString Message = FString::Printf(TEXT("Number of entries updated: %llu"), ExportForTargetEntriesUpdated);
 				UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *Message);
 
-				if (!IsRunningCommandlet())
+				if (ExportJob.IsValid())
 				{
-					FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
-					ExportForTargetToGridlySlowTask.Reset();
+					ExportJob->Complete(FText::FromString(Message));
+					ExportJob.Reset();
 				}
 
 				bExportRequestInProgress = false;
@@ -613,14 +1017,14 @@ void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(F
 		else
 		{
 			// Handle HTTP error
-			const FString Content = HttpResponsePtr->GetContentAsString();
+			const FString Content = FGridlyApi::GetContentAsString(HttpResponsePtr);
 			const FString ErrorReason = FString::Printf(TEXT("Error: %d, reason: %s"), HttpResponsePtr->GetResponseCode(), *Content);
 			UE_LOG(LogGridlyEditor, Error, TEXT("%s"), *ErrorReason);
 
-			if (!IsRunningCommandlet())
+			if (ExportJob.IsValid())
 			{
-				FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ErrorReason));
-				ExportForTargetToGridlySlowTask.Reset();
+				ExportJob->Fail(FText::FromString(ErrorReason));
+				ExportJob.Reset();
 			}
 
 			bExportRequestInProgress = false;
@@ -629,10 +1033,10 @@ void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(F
 	else
 	{
 		// Handle failure
-		if (!IsRunningCommandlet())
+		if (ExportJob.IsValid())
 		{
-			FMessageDialog::Open(EAppMsgType::Ok, LOCTEXT("GridlyConnectionError", "ERROR: Unable to connect to Gridly"));
-			ExportForTargetToGridlySlowTask.Reset();
+			ExportJob->Fail(LOCTEXT("GridlyConnectionError", "ERROR: Unable to connect to Gridly"));
+			ExportJob.Reset();
 		}
 
 		bExportRequestInProgress = false;
@@ -640,51 +1044,143 @@ void FGridlyLocalizationServiceProvider::OnExportTranslationsForTargetToGridly(F
 }
 
 
-void FGridlyLocalizationServiceProvider::ExportForTargetToGridly(ULocalizationTarget* InLocalizationTarget, FHttpRequestCompleteDelegate& ReqDelegate, const FText& SlowTaskText, bool bIncTargetTranslation)
+void FGridlyLocalizationServiceProvider::ExportForTargetToGridly(ULocalizationTarget* InLocalizationTarget, FHttpRequestCompleteDelegate& ReqDelegate, const FText& JobTitle, bool bIncTargetTranslation)
 {
 	TArray<FPolyglotTextData> PolyglotTextDatas;
 	TSharedPtr<FLocTextHelper> LocTextHelperPtr;
+
+	if (FGridlyLocalizedText::GetAllTextAsPolyglotTextDatas(InLocalizationTarget, PolyglotTextDatas, LocTextHelperPtr))
+	{
+		ExportPolyglotTextDatasToGridly(MoveTemp(PolyglotTextDatas), LocTextHelperPtr, ReqDelegate, JobTitle, bIncTargetTranslation);
+	}
+}
+
+void FGridlyLocalizationServiceProvider::ExportPolyglotTextDatasToGridly(TArray<FPolyglotTextData> PolyglotTextDatas,
+	const TSharedPtr<FLocTextHelper>& LocTextHelperPtr, FHttpRequestCompleteDelegate& ReqDelegate, const FText& JobTitle,
+	bool bIncTargetTranslation)
+{
 	UERecords.Empty();
 	GridlyRecords.Empty();
 
-
-	if (FGridlyLocalizedText::GetAllTextAsPolyglotTextDatas(InLocalizationTarget, PolyglotTextDatas, LocTextHelperPtr))
+	// All requests are created before the first is sent, so chunks are sized from the texts' lengths
+	FGridlyBatchSizer BatchSizer;
+	BatchSizer.Reset(GetMutableDefault<UGridlyGameSettings>()->ExportMaxRecordsPerRequest);
+	const TArray<int32> ChunkSizes = BatchSizer.Split(PolyglotTextDatas, [bIncTargetTranslation](const FPolyglotTextData& PolyglotTextData)
 	{
-		size_t TotalRequests = 0;
+		// Strings plus roughly the JSON around each cell
+		const int64 CellOverhead = 32;
+		int64 NumBytes = PolyglotTextData.GetKey().Len() + PolyglotTextData.GetNamespace().Len()
+			+ PolyglotTextData.GetNativeString().Len() + 3 * CellOverhead;
 
-		while (PolyglotTextDatas.Num() > 0)
+		if (bIncTargetTranslation)
 		{
-			const size_t ChunkSize = FMath::Min(GetMutableDefault<UGridlyGameSettings>()->ExportMaxRecordsPerRequest, PolyglotTextDatas.Num());
-			const TArray<FPolyglotTextData> ChunkPolyglotTextDatas(PolyglotTextDatas.GetData(), ChunkSize);
-			PolyglotTextDatas.RemoveAt(0, ChunkSize);
-			const auto HttpRequest = CreateExportRequest(ChunkPolyglotTextDatas, LocTextHelperPtr, bIncTargetTranslation);
-			HttpRequest->OnProcessRequestComplete() = ReqDelegate;
-			ExportFromTargetRequestQueue.Enqueue(HttpRequest);
-			for (int i = 0; i < ChunkPolyglotTextDatas.Num(); i++)
+			for (const FString& Culture : PolyglotTextData.GetLocalizedCultures())
 			{
-				const FString& Key = ChunkPolyglotTextDatas[i].GetKey();  // Access the correct array
-				const FString& Namespace = ChunkPolyglotTextDatas[i].GetNamespace();  // Access the correct array
-				
-				UERecords.Add(FGridlyTypeRecord(Key, Namespace));
+				FString LocalizedString;
+				PolyglotTextData.GetLocalizedString(Culture, LocalizedString);
+				NumBytes += LocalizedString.Len() + CellOverhead;
 			}
+		}
+
+		return NumBytes;
+	});
+
+	TArray<TArray<FPolyglotTextData>> Chunks;
+	Chunks.Reserve(ChunkSizes.Num());
+
+	int32 ChunkStart = 0;
+	for (const int32 ChunkSize : ChunkSizes)
+	{
+		const TArray<FPolyglotTextData>& ChunkPolyglotTextDatas = Chunks.Emplace_GetRef(PolyglotTextDatas.GetData() + ChunkStart, ChunkSize);
+		ChunkStart += ChunkSize;
+		for (int i = 0; i < ChunkPolyglotTextDatas.Num(); i++)
+		{
+			const FString& Key = ChunkPolyglotTextDatas[i].GetKey();  // Access the correct array
+			const FString& Namespace = ChunkPolyglotTextDatas[i].GetNamespace();  // Access the correct array
+			
+			UERecords.Add(FGridlyTypeRecord(SessionStrings.Intern(Key), SessionStrings.Intern(Namespace)));
+		}
+	}
+
+	ExportForTargetEntriesUpdated = 0;
+
+	if (Chunks.Num() == 0)
+	{
+		return;
+	}
 
-			TotalRequests++;
+	// Counts as in progress while the texts are converted, so the commandlet keeps waiting
+	bExportRequestInProgress = true;
+
+	if (IsRunningCommandlet())
+	{
+		TArray<FString> Payloads;
+		Payloads.Reserve(Chunks.Num());
+		for (const TArray<FPolyglotTextData>& Chunk : Chunks)
+		{
+			Payloads.Add(CreateExportPayload(Chunk, LocTextHelperPtr, bIncTargetTranslation));
 		}
 
-		ExportForTargetEntriesUpdated = 0;
+		StartExportRequests(Payloads, ReqDelegate);
+		return;
+	}
+
+	ExportJob = MakeShared<FGridlyBackgroundJob>(JobTitle,
+		FSimpleDelegate::CreateRaw(this, &FGridlyLocalizationServiceProvider::CancelAll));
+	ExportJob->SetProgress(LOCTEXT("GridlyExportConverting", "Converting texts"));
 
-		TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
-		if (ExportFromTargetRequestQueue.Dequeue(HttpRequest))
+	// In the editor the texts are converted on a worker thread, and the requests are sent from the game thread
+	const FGridlyCancellationToken ExportCancellationToken = CancellationToken;
+	const FHttpRequestCompleteDelegate RequestCompleteDelegate = ReqDelegate;
+	Async(EAsyncExecution::ThreadPool,
+		[this, Chunks = MoveTemp(Chunks), LocTextHelperPtr, bIncTargetTranslation, ExportCancellationToken, RequestCompleteDelegate]()
 		{
-			if (!IsRunningCommandlet())
+			TArray<FString> Payloads;
+			Payloads.Reserve(Chunks.Num());
+			for (const TArray<FPolyglotTextData>& Chunk : Chunks)
 			{
-				ExportForTargetToGridlySlowTask = MakeShareable(new FScopedSlowTask(static_cast<float>(TotalRequests), SlowTaskText));
-				ExportForTargetToGridlySlowTask->MakeDialog();
+				if (ExportCancellationToken.IsCancelled())
+				{
+					return;
+				}
+
+				Payloads.Add(CreateExportPayload(Chunk, LocTextHelperPtr, bIncTargetTranslation));
 			}
 
-			bExportRequestInProgress = true;
-			HttpRequest->ProcessRequest();
+			AsyncTask(ENamedThreads::GameThread, [this, Payloads = MoveTemp(Payloads), ExportCancellationToken, RequestCompleteDelegate]()
+			{
+				if (!ExportCancellationToken.IsCancelled())
+				{
+					StartExportRequests(Payloads, RequestCompleteDelegate);
+				}
+			});
+		});
+}
+
+void FGridlyLocalizationServiceProvider::StartExportRequests(const TArray<FString>& Payloads, const FHttpRequestCompleteDelegate& ReqDelegate)
+{
+	for (const FString& Payload : Payloads)
+	{
+		const auto HttpRequest = CreateExportRequest(Payload);
+		HttpRequest->OnProcessRequestComplete() = ReqDelegate;
+		ExportFromTargetRequestQueue.Enqueue(HttpRequest);
+	}
+
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+	if (ExportFromTargetRequestQueue.Dequeue(HttpRequest))
+	{
+		if (ExportJob.IsValid())
+		{
+			ExportJob->SetProgress(FText::Format(LOCTEXT("GridlyExportUploading", "Uploading {0} requests"), Payloads.Num()));
 		}
+
+		bExportRequestInProgress = true;
+		CurrentExportRequest = HttpRequest;
+		FGridlyApi::ProcessRequest(HttpRequest.ToSharedRef());
+	}
+	else
+	{
+		bExportRequestInProgress = false;
 	}
 }
 
@@ -702,42 +1198,52 @@ void FGridlyLocalizationServiceProvider::FetchGridlyCSV()
 {
 	// Set the flag to true at the beginning of the process
 	bHasDeletesPending = true;
+
+	if (!IsRunningCommandlet())
+	{
+		SyncJob = MakeShared<FGridlyBackgroundJob>(LOCTEXT("GridlySyncJob", "Removing records from Gridly that are no longer in Unreal"),
+			FSimpleDelegate::CreateRaw(this, &FGridlyLocalizationServiceProvider::CancelAll));
+		SyncJob->SetProgress(LOCTEXT("GridlySyncFetching", "Fetching records from Gridly"));
+	}
 	
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 	const FString ApiKey = GameSettings->ExportApiKey;
 	const FString ViewId = GameSettings->ExportViewId;
 	// URL for fetching the CSV from Gridly
-	FStringFormatNamedArguments Args;
-	Args.Add(TEXT("ViewId"), *ViewId);
-	const FString GridlyURL = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/export"), Args);
+	const FString GridlyURL = FGridlyApi::GetViewUrl(ViewId, TEXT("export"));
 
 	// Create the HTTP request
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetURL(GridlyURL);
-
-	// Set the required headers, including the authorization
-	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FGridlyApi::CreateRequest(TEXT("GET"), GridlyURL, ApiKey);
 	HttpRequest->SetHeader(TEXT("Accept"), TEXT("text/csv"));
 
 	// Bind a callback to handle the response
 	HttpRequest->OnProcessRequestComplete().BindRaw(this, &FGridlyLocalizationServiceProvider::OnGridlyCSVResponseReceived);
 
 	// Send the request
-	HttpRequest->ProcessRequest();
+	PendingSyncRequests.Add(HttpRequest);
+	FGridlyApi::ProcessRequest(HttpRequest);
 }
 
 void FGridlyLocalizationServiceProvider::OnGridlyCSVResponseReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+	GRIDLY_PERF_HTTP(Sync, Request, Response);
+
+	PendingSyncRequests.Remove(Request);
+
 	if (!bWasSuccessful || !Response.IsValid())
 	{
 		UE_LOG(LogTemp, Error, TEXT("Failed to fetch Gridly CSV"));
 		bHasDeletesPending = false; // Reset flag on failure
+		if (SyncJob.IsValid())
+		{
+			SyncJob->Fail(LOCTEXT("GridlySyncFetchFailed", "Failed to fetch records from Gridly"));
+			SyncJob.Reset();
+		}
 		return;
 	}
 
 	// Retrieve the response content (CSV data)
-	FString CSVContent = Response->GetContentAsString();
+	FString CSVContent = FGridlyApi::GetContentAsString(Response);
 
 	// Parse the CSV data to extract records
 	ParseCSVAndCreateRecords(CSVContent);
@@ -748,196 +1254,221 @@ void FGridlyLocalizationServiceProvider::ParseCSVAndCreateRecords(const FString&
 	// Don't reset the flag here, it will be reset in DeleteRecordsFromGridly if there are no records to delete
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 	
-	const TCHAR QuoteChar = TEXT('"');
-	const TCHAR Delimiter = TEXT(',');
+	{
+		GRIDLY_PERF_SCOPE(Sync, Parse);
 
-	bool bInsideQuotes = false;
-	FString CurrentField;
-	TArray<FString> Fields;
-	FString CurrentLine;
+		const TCHAR QuoteChar = TEXT('"');
+		const TCHAR Delimiter = TEXT(',');
 
-	// Buffer to store the accumulated lines in case of multi-line records
-	TArray<FString> AccumulatedLines;
+		bool bInsideQuotes = false;
+		FString CurrentField;
+		TArray<FString> Fields;
+		FString CurrentLine;
 
-	int32 RecordIdColumnIndex = -1;
-	int32 PathColumnIndex = -1;
+		// Buffer to store the accumulated lines in case of multi-line records
+		TArray<FString> AccumulatedLines;
 
-	// First pass: determine which columns contain the Record ID and Path
-	bool bFoundHeader = false;
-	for (int32 i = 0; i < CSVContent.Len(); ++i)
-	{
-		TCHAR Char = CSVContent[i];
+		int32 RecordIdColumnIndex = -1;
+		int32 PathColumnIndex = -1;
 
-		if (bInsideQuotes)
+		// First pass: determine which columns contain the Record ID and Path
+		bool bFoundHeader = false;
+		for (int32 i = 0; i < CSVContent.Len(); ++i)
 		{
-			if (Char == QuoteChar)
+			TCHAR Char = CSVContent[i];
+
+			if (bInsideQuotes)
 			{
-				if (i + 1 < CSVContent.Len() && CSVContent[i + 1] == QuoteChar)
+				if (Char == QuoteChar)
 				{
-					CurrentField += QuoteChar;
-					++i;
+					if (i + 1 < CSVContent.Len() && CSVContent[i + 1] == QuoteChar)
+					{
+						CurrentField += QuoteChar;
+						++i;
+					}
+					else
+					{
+						bInsideQuotes = false;
+					}
 				}
 				else
 				{
-					bInsideQuotes = false;
+					CurrentField += Char;
 				}
 			}
 			else
 			{
-				CurrentField += Char;
-			}
-		}
-		else
-		{
-			if (Char == QuoteChar)
-			{
-				bInsideQuotes = true;
-			}
-			else if (Char == Delimiter)
-			{
-				Fields.Add(CurrentField);
-				CurrentField.Empty();
-			}
-			else if (Char == '\n' || Char == '\r')
-			{
-				// End of header line, process the column headers
-				if (Fields.Num() > 0 || !CurrentField.IsEmpty())
+				if (Char == QuoteChar)
+				{
+					bInsideQuotes = true;
+				}
+				else if (Char == Delimiter)
 				{
 					Fields.Add(CurrentField);
 					CurrentField.Empty();
 				}
-
-				if (!bFoundHeader)
+				else if (Char == '\n' || Char == '\r')
 				{
-					for (int32 ColumnIndex = 0; ColumnIndex < Fields.Num(); ++ColumnIndex)
+					// End of header line, process the column headers
+					if (Fields.Num() > 0 || !CurrentField.IsEmpty())
 					{
-						FString ColumnName = Fields[ColumnIndex].TrimQuotes();
+						Fields.Add(CurrentField);
+						CurrentField.Empty();
+					}
 
-						if (ColumnName.Equals(TEXT("Record ID"), ESearchCase::IgnoreCase))
-						{
-							RecordIdColumnIndex = ColumnIndex;
-						}
-						else if (ColumnName.Equals(TEXT("Path"), ESearchCase::IgnoreCase))
+					if (!bFoundHeader)
+					{
+						for (int32 ColumnIndex = 0; ColumnIndex < Fields.Num(); ++ColumnIndex)
 						{
-							PathColumnIndex = ColumnIndex;
+							FString ColumnName = Fields[ColumnIndex].TrimQuotes();
+
+							if (ColumnName.Equals(TEXT("Record ID"), ESearchCase::IgnoreCase))
+							{
+								RecordIdColumnIndex = ColumnIndex;
+							}
+							else if (ColumnName.Equals(TEXT("Path"), ESearchCase::IgnoreCase))
+							{
+								PathColumnIndex = ColumnIndex;
+							}
 						}
-					}
 
-					bFoundHeader = true;
-					Fields.Empty();
+						bFoundHeader = true;
+						Fields.Empty();
+					}
+				}
+				else
+				{
+					CurrentField += Char;
 				}
 			}
-			else
+		}
+
+		// Check if we found both necessary columns
+		if (RecordIdColumnIndex == -1 || PathColumnIndex == -1)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to identify Record ID or Path columns in CSV."));
+			bHasDeletesPending = false; // Reset flag if we can't identify the columns
+			if (SyncJob.IsValid())
 			{
-				CurrentField += Char;
+				SyncJob->Fail(LOCTEXT("GridlySyncColumnsNotFound", "Failed to identify the record ID and path columns of the records from Gridly"));
+				SyncJob.Reset();
 			}
+			return;
 		}
-	}
 
-	// Check if we found both necessary columns
-	if (RecordIdColumnIndex == -1 || PathColumnIndex == -1)
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to identify Record ID or Path columns in CSV."));
-		bHasDeletesPending = false; // Reset flag if we can't identify the columns
-		return;
-	}
-
-	// Second pass: parse the actual records
-	bInsideQuotes = false;
-	Fields.Empty();
-	CurrentField.Empty();
-	for (int32 i = 0; i < CSVContent.Len(); ++i)
-	{
-		TCHAR Char = CSVContent[i];
-
-		if (bInsideQuotes)
+		// Second pass: parse the actual records
+		bInsideQuotes = false;
+		Fields.Empty();
+		CurrentField.Empty();
+		for (int32 i = 0; i < CSVContent.Len(); ++i)
 		{
-			if (Char == QuoteChar)
+			TCHAR Char = CSVContent[i];
+
+			if (bInsideQuotes)
 			{
-				if (i + 1 < CSVContent.Len() && CSVContent[i + 1] == QuoteChar)
+				if (Char == QuoteChar)
 				{
-					CurrentField += QuoteChar;
-					++i;
+					if (i + 1 < CSVContent.Len() && CSVContent[i + 1] == QuoteChar)
+					{
+						CurrentField += QuoteChar;
+						++i;
+					}
+					else
+					{
+						bInsideQuotes = false;
+					}
 				}
 				else
 				{
-					bInsideQuotes = false;
+					CurrentField += Char;
 				}
 			}
-			else
-			{
-				CurrentField += Char;
-			}
-		}
-		else
-		{
-			if (Char == QuoteChar)
-			{
-				bInsideQuotes = true;
-			}
-			else if (Char == Delimiter)
-			{
-				Fields.Add(CurrentField);
-				CurrentField.Empty();
-			}
-			else if (Char == '\n' || Char == '\r')
+			else
 			{
-				if (Fields.Num() > 0 || !CurrentField.IsEmpty())
+				if (Char == QuoteChar)
+				{
+					bInsideQuotes = true;
+				}
+				else if (Char == Delimiter)
 				{
 					Fields.Add(CurrentField);
 					CurrentField.Empty();
 				}
-
-				if (Fields.Num() > FMath::Max(RecordIdColumnIndex, PathColumnIndex))
+				else if (Char == '\n' || Char == '\r')
 				{
-					FString RecordId = Fields[RecordIdColumnIndex].TrimQuotes();
-					FString Path = Fields[PathColumnIndex].TrimQuotes();
+					if (Fields.Num() > 0 || !CurrentField.IsEmpty())
+					{
+						Fields.Add(CurrentField);
+						CurrentField.Empty();
+					}
+
+					if (Fields.Num() > FMath::Max(RecordIdColumnIndex, PathColumnIndex))
+					{
+						FString RecordId = Fields[RecordIdColumnIndex].TrimQuotes();
+						FString Path = Fields[PathColumnIndex].TrimQuotes();
 
 
-					FGridlyTypeRecord NewRecord(RemoveNamespaceFromKey(RecordId), Path);
+						const FString Id = RemoveNamespaceFromKey(RecordId);
 
-					if (NewRecord.Id != "Record ID") {
-						GridlyRecords.Add(NewRecord);
+						if (Id != "Record ID") {
+							GridlyRecords.Add(FGridlyTypeRecord(SessionStrings.Intern(Id), SessionStrings.Intern(Path)));
+						}
 					}
-				}
 
-				Fields.Empty();
-			}
-			else
-			{
-				CurrentField += Char;
+					Fields.Empty();
+				}
+				else
+				{
+					CurrentField += Char;
+				}
 			}
 		}
-	}
 
-	// Handle the last line if needed
-	if (Fields.Num() > 0 || !CurrentField.IsEmpty())
-	{
-		Fields.Add(CurrentField);
-		if (Fields.Num() > FMath::Max(RecordIdColumnIndex, PathColumnIndex))
+		// Handle the last line if needed
+		if (Fields.Num() > 0 || !CurrentField.IsEmpty())
 		{
-			FString RecordId = Fields[RecordIdColumnIndex].TrimQuotes();
-			FString Path = Fields[PathColumnIndex].TrimQuotes();
+			Fields.Add(CurrentField);
+			if (Fields.Num() > FMath::Max(RecordIdColumnIndex, PathColumnIndex))
+			{
+				FString RecordId = Fields[RecordIdColumnIndex].TrimQuotes();
+				FString Path = Fields[PathColumnIndex].TrimQuotes();
 
 
-			FGridlyTypeRecord NewRecord(RemoveNamespaceFromKey(RecordId), Path);
+				const FString Id = RemoveNamespaceFromKey(RecordId);
 
-			if (NewRecord.Id != "Record ID") {
-				GridlyRecords.Add(NewRecord);
+				if (Id != "Record ID") {
+					GridlyRecords.Add(FGridlyTypeRecord(SessionStrings.Intern(Id), SessionStrings.Intern(Path)));
+				}
 			}
 		}
 	}
+	FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::Sync, GridlyRecords.Num());
 
 	for (const FGridlyTypeRecord& Record : UERecords)
 	{
-		UE_LOG(LogTemp, Log, TEXT("UE Record ID: %s, Path: %s"), *Record.Id, *Record.Path);
+		UE_LOG(LogTemp, Log, TEXT("UE Record ID: %s, Path: %s"), *SessionStrings.Resolve(Record.Id), *SessionStrings.Resolve(Record.Path));
 	}
 	
 
 	// Log or further process the GridlyRecords array
 	for (const FGridlyTypeRecord& Record : GridlyRecords)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Gridly Record ID: %s, Path: %s"), *Record.Id, *Record.Path);
+		UE_LOG(LogTemp, Log, TEXT("Gridly Record ID: %s, Path: %s"), *SessionStrings.Resolve(Record.Id), *SessionStrings.Resolve(Record.Path));
+	}
+
+	// Match on case-insensitive handles, the same way the strings used to be compared
+	const auto MakeRecordKey = [this](const FGridlyTypeRecord& Record)
+	{
+		return (static_cast<uint64>(SessionStrings.GetCaseInsensitiveHandle(Record.Path)) << 32) | static_cast<uint32>(SessionStrings.GetCaseInsensitiveHandle(Record.Id));
+	};
+
+	GRIDLY_PERF_SCOPE(Sync, Diff);
+
+	TSet<uint64> UERecordKeys;
+	UERecordKeys.Reserve(UERecords.Num());
+	for (const FGridlyTypeRecord& UERecord : UERecords)
+	{
+		UERecordKeys.Add(MakeRecordKey(UERecord));
 	}
 
 	TArray<FString> RecordsToDelete;
@@ -945,42 +1476,28 @@ void FGridlyLocalizationServiceProvider::ParseCSVAndCreateRecords(const FString&
 
 	for (const FGridlyTypeRecord& GridlyRecord : GridlyRecords)
 	{
-		// Check if any UERecord has a matching path first
-		bool PathFoundInUE = false;
-		bool RecordIdFoundInUE = false;
-
-		for (const FGridlyTypeRecord& UERecord : UERecords)
+		// Delete when UE has no record with both the same path and the same record ID
+		if (!UERecordKeys.Contains(MakeRecordKey(GridlyRecord)))
 		{
-			if (GridlyRecord.Path == UERecord.Path)
-			{
-				PathFoundInUE = true; // The path matches
-				if (GridlyRecord.Id == UERecord.Id)
-				{
-					RecordIdFoundInUE = true; // The record ID matches as well for the same path
-					break; // Both path and record ID match, no need to continue searching
-				}
-			}
-		}
+			const FString& Id = SessionStrings.Resolve(GridlyRecord.Id);
+			const FString& Path = SessionStrings.Resolve(GridlyRecord.Path);
 
-		// Only handle deletion if the path was found, but the ID was not found for that path or path not found in UE
-		if ((PathFoundInUE && !RecordIdFoundInUE ) || !PathFoundInUE)
-		{
-			UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("No match found for GridlyRecord: ID = %s, Path = %s. Adding to delete list."), *GridlyRecord.Id, *GridlyRecord.Path);
+			UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("No match found for GridlyRecord: ID = %s, Path = %s. Adding to delete list."), *Id, *Path);
 
 			// If the path is empty or used combine namespace and ID is false, we only add the record ID
-			if (GridlyRecord.Path.Len() == 0 || !GameSettings->bUseCombinedNamespaceId)
+			if (Path.Len() == 0 || !GameSettings->bUseCombinedNamespaceId)
 			{
-				RecordsToDelete.Add(GridlyRecord.Id);
+				RecordsToDelete.Add(Id);
 			}
 			// If the path starts with "blueprints/", add the ID with a comma prefix
-			else if (GridlyRecord.Path.StartsWith(TEXT("blueprints/")))
+			else if (Path.StartsWith(TEXT("blueprints/")))
 			{
-				RecordsToDelete.Add("," + GridlyRecord.Id);
+				RecordsToDelete.Add("," + Id);
 			}
 			else
 			{
 				// Otherwise, add the path and ID combination
-				RecordsToDelete.Add(GridlyRecord.Path + "," + GridlyRecord.Id);
+				RecordsToDelete.Add(Path + "," + Id);
 			}
 		}
 	}
@@ -1001,12 +1518,17 @@ void FGridlyLocalizationServiceProvider::ParseCSVAndCreateRecords(const FString&
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("No records to delete."));
 		bHasDeletesPending = false; // Reset flag if there are no records to delete
+		if (SyncJob.IsValid())
+		{
+			SyncJob->Complete(LOCTEXT("GridlySyncNothingToDelete", "No records to delete"));
+			SyncJob.Reset();
+		}
 	}
 }
 
 void FGridlyLocalizationServiceProvider::DeleteRecordsFromGridly(const TArray<FString>& RecordsToDelete)
 {
-	const int32 MaxRecordsPerRequest = 1000;  // Maximum number of records per batch
+	const int32 MaxRecordsPerRequest = 1000;  // Maximum number of records per batch, the API limit
 	UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("DeleteRecordsFromGridly CALLED"));
 
 	if (RecordsToDelete.Num() == 0)
@@ -1016,25 +1538,26 @@ void FGridlyLocalizationServiceProvider::DeleteRecordsFromGridly(const TArray<FS
 		return;
 	}
 	bHasDeletesPending = true;
-	// Initialize the counters
-	CompletedBatches = 0;  // Reset the counter for completed batches
-	TotalBatchesToProcess = FMath::CeilToInt(static_cast<float>(RecordsToDelete.Num()) / MaxRecordsPerRequest);
 
-
-	// Split the records into batches of MaxRecordsPerRequest
-	int32 TotalRecords = RecordsToDelete.Num();
-	int32 TotalBatches = FMath::CeilToInt(static_cast<float>(TotalRecords) / MaxRecordsPerRequest);
+	// Split the records into batches of at most MaxRecordsPerRequest, and within the request size budget
+	FGridlyBatchSizer BatchSizer;
+	BatchSizer.Reset(MaxRecordsPerRequest);
+	const TArray<int32> BatchSizes = BatchSizer.Split(RecordsToDelete, [](const FString& RecordId)
+	{
+		// The ID plus its quotes and separator
+		return static_cast<int64>(RecordId.Len()) + 3;
+	});
 	CompletedBatches = 0;  // Initialize the completed batch counter
-	TotalBatchesToProcess = TotalBatches;  // Track the total number of batches
+	TotalBatchesToProcess = BatchSizes.Num();  // Track the total number of batches
 
-
-	for (int32 BatchIndex = 0; BatchIndex < TotalBatches; BatchIndex++)
+	int32 EndIndex = 0;
+	for (const int32 BatchSize : BatchSizes)
 	{
 		// Create a new array for each batch
 		TArray<FString> BatchRecords;
 
-		int32 StartIndex = BatchIndex * MaxRecordsPerRequest;
-		int32 EndIndex = FMath::Min(StartIndex + MaxRecordsPerRequest, TotalRecords); // Ensure not to exceed total records
+		const int32 StartIndex = EndIndex;
+		EndIndex = StartIndex + BatchSize;
 
 		// Manually append the batch records
 		for (int32 i = StartIndex; i < EndIndex; ++i)
@@ -1061,7 +1584,8 @@ void FGridlyLocalizationServiceProvider::DeleteRecordsFromGridly(const TArray<FS
 
 		JsonObject->SetArrayField(TEXT("ids"), JsonIds);
 
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonPayload);
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonPayload);
 		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
 		// Log the JSON payload for debugging
@@ -1071,21 +1595,16 @@ void FGridlyLocalizationServiceProvider::DeleteRecordsFromGridly(const TArray<FS
 		const FString ApiKey = GameSettings->ExportApiKey;
 		const FString ViewId = GameSettings->ExportViewId;
 
-		FStringFormatNamedArguments Args;
-		Args.Add(TEXT("ViewId"), *ViewId);
-		const FString Url = FString::Format(TEXT("https://api.gridly.com/v1/views/{ViewId}/records"), Args);
+		const FString Url = FGridlyApi::GetViewUrl(ViewId, TEXT("records"));
 
-		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-		HttpRequest->SetVerb(TEXT("DELETE"));
-		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-		HttpRequest->SetURL(Url);
-		HttpRequest->SetContentAsString(JsonPayload);
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FGridlyApi::CreateRequest(TEXT("DELETE"), Url, ApiKey);
+		FGridlyApi::SetContent(HttpRequest, JsonPayload);
 
 		// Bind the response handler for each batch
 		HttpRequest->OnProcessRequestComplete().BindRaw(this, &FGridlyLocalizationServiceProvider::OnDeleteRecordsResponse);
 
-		HttpRequest->ProcessRequest();
+		PendingSyncRequests.Add(HttpRequest);
+		FGridlyApi::ProcessRequest(HttpRequest);
 
 		// Track the number of records requested for deletion
 		ExportForTargetEntriesDeleted += BatchRecords.Num();
@@ -1096,11 +1615,19 @@ void FGridlyLocalizationServiceProvider::DeleteRecordsFromGridly(const TArray<FS
 
 void FGridlyLocalizationServiceProvider::OnDeleteRecordsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
 {
+	GRIDLY_PERF_HTTP(Sync, Request, Response);
+
+	PendingSyncRequests.Remove(Request);
+
 	if (!Request.IsValid() || !Response.IsValid())
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("Invalid HTTP request or response."));
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("Invalid HTTP request or response.")));
 		bHasDeletesPending = false;  // Reset flag on invalid request/response
+		if (SyncJob.IsValid())
+		{
+			SyncJob->Fail(LOCTEXT("GridlySyncInvalidResponse", "Invalid HTTP request or response."));
+			SyncJob.Reset();
+		}
 		return;
 	}
 
@@ -1116,12 +1643,11 @@ void FGridlyLocalizationServiceProvider::OnDeleteRecordsResponse(FHttpRequestPtr
 		{
 			bHasDeletesPending = false;
 
-			if (!IsRunningCommandlet())
+			if (SyncJob.IsValid())
 			{
-				// Show dialog only in editor mode
-				FString Message = FString::Printf(TEXT("Number of entries deleted: %llu"), ExportForTargetEntriesDeleted);
-				UE_LOG(LogGridlyEditor, Log, TEXT("%s"), *Message);
-				FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
+				const FString Message = FString::Printf(TEXT("Number of entries deleted: %llu"), ExportForTargetEntriesDeleted);
+				SyncJob->Complete(FText::FromString(Message));
+				SyncJob.Reset();
 			}
 			else
 			{
@@ -1133,21 +1659,24 @@ void FGridlyLocalizationServiceProvider::OnDeleteRecordsResponse(FHttpRequestPtr
 	{
 		// Handle any failure cases
 		FString ErrorMessage = FString::Printf(TEXT("Failed to delete records. HTTP Code: %d, Response: %s"),
-			Response->GetResponseCode(), *Response->GetContentAsString());
+			Response->GetResponseCode(), *FGridlyApi::GetContentAsString(Response));
 
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("%s"), *ErrorMessage);
+		if (SyncJob.IsValid())
+		{
+			SyncJob->AddMessage(EMessageSeverity::Error, FText::FromString(ErrorMessage));
+		}
 
 		// Reset the flag when all batches are done, regardless of success or failure
 		if (CompletedBatches == TotalBatchesToProcess)
 		{
 			bHasDeletesPending = false;
 			
-			if (!IsRunningCommandlet())
+			if (SyncJob.IsValid())
 			{
-				FString DialogMessage = FString::Printf(TEXT("Error during record deletion.\nHTTP Code: %d\nResponse: %s"),
-					Response->GetResponseCode(), *Response->GetContentAsString());
-
-				FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(DialogMessage));
+				SyncJob->Fail(FText::Format(LOCTEXT("GridlySyncDeleteFailed", "Error during record deletion, HTTP code {0}"),
+					Response->GetResponseCode()));
+				SyncJob.Reset();
 			}
 		}
 	}
@@ -1202,64 +1731,144 @@ void FGridlyLocalizationServiceProvider::DownloadSourceChangesFromGridly(TWeakOb
 	}
 }
 
-void FGridlyLocalizationServiceProvider::DownloadSourceChangesFromGridlyInternal(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, const FString& NativeCulture)
+bool FGridlyLocalizationServiceProvider::DownloadSourceChangesFromGridlyInternal(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, const FString& NativeCulture)
 {
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 	const FString ApiKey = GameSettings->ImportApiKey;
+	bSourceDownloadFailed = false;
 
 	if (ApiKey.IsEmpty())
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ No import API key configured"));
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ No import API key configured.\n\nPlease configure the Gridly plugin settings:\n1. Go to Project Settings > Plugins > Gridly\n2. Set the Import API Key\n3. Add at least one Import View ID")));
-		return;
+		bSourceDownloadFailed = true;
+		if (!IsRunningCommandlet())
+		{
+			FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ No import API key configured.\n\nPlease configure the Gridly plugin settings:\n1. Go to Project Settings > Plugins > Gridly\n2. Set the Import API Key\n3. Add at least one Import View ID")));
+		}
+		return false;
 	}
 
 	// Get the first view ID for import
 	if (GameSettings->ImportFromViewIds.Num() == 0 || GameSettings->ImportFromViewIds[0].IsEmpty())
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ No import view ID configured"));
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ No import view ID configured.\n\nPlease configure the Gridly plugin settings:\n1. Go to Project Settings > Plugins > Gridly\n2. Add at least one Import View ID")));
-		return;
+		bSourceDownloadFailed = true;
+		if (!IsRunningCommandlet())
+		{
+			FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ No import view ID configured.\n\nPlease configure the Gridly plugin settings:\n1. Go to Project Settings > Plugins > Gridly\n2. Add at least one Import View ID")));
+		}
+		return false;
+	}
+
+	if (!SourceChangesJob.IsValid())
+	{
+		SourceChangesJob = MakeShared<FGridlyBackgroundJob>(LOCTEXT("GridlySourceChangesJob", "Downloading source changes from Gridly"),
+			FSimpleDelegate::CreateRaw(this, &FGridlyLocalizationServiceProvider::CancelAll));
 	}
 
 	const FString ViewId = GameSettings->ImportFromViewIds[0];
-	const int32 Limit = FMath::Clamp(GameSettings->ImportMaxRecordsPerRequest, 1, 1000);
+	SourceDownloadBatchSizer.Reset(FMath::Clamp(GameSettings->ImportMaxRecordsPerRequest, 1, 1000));
 
 	// Pagination: start at offset 0 so we fetch all records (all namespaces), not just the first page
 	CurrentSourceDownloadOffset = 0;
 	CurrentSourceDownloadTotalCount = 0;
+	CurrentSourceDownloadLimit = SourceDownloadBatchSizer.GetBatchSize();
 	AccumulatedSourceDownloadNamespaceRecords.Reset();
-
-	const FString PaginationSettings = FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("{\"offset\":%d,\"limit\":%d}"), 0, Limit));
-	const FString Url = FString::Printf(TEXT("https://api.gridly.com/v1/views/%s/records?page=%s"), *ViewId, *PaginationSettings);
-
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *ApiKey));
-	HttpRequest->SetURL(Url);
+	AccumulatedSourceDownloadBytes = 0;
+	SpilledSourceDownloadNamespaces.Reset();
 
 	CurrentSourceDownloadTarget = LocalizationTarget;
 	CurrentSourceDownloadCulture = NativeCulture;
 
+	// Only the namespace and the native culture's source column are read
+	const TArray<FString> ColumnIds = FGridlyApi::GetTextColumnIds({ NativeCulture }, {});
+
+	// Replay pages checkpointed by an earlier attempt, then continue after the last one
+	SourceDownloadCheckpoint.Open(TEXT("DownloadSourceChanges"), ViewId + TEXT("|") + NativeCulture + TEXT("|") + FString::Join(ColumnIds, TEXT(",")));
+	bVerifySourceDownloadCheckpoint = false;
+	for (const FGridlyDownloadCheckpoint::FPage& Page : SourceDownloadCheckpoint.GetPages())
+	{
+		FString Content;
+		int32 NumPageRecords = 0;
+		if (!SourceDownloadCheckpoint.LoadPage(Page, Content) || !AccumulateSourceChangesPage(Content, NumPageRecords))
+		{
+			UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("⚠️ Could not read checkpointed page at offset %d, starting over"), Page.Offset);
+			SourceDownloadCheckpoint.Discard();
+			AccumulatedSourceDownloadNamespaceRecords.Reset();
+			AccumulatedSourceDownloadBytes = 0;
+			SpilledSourceDownloadNamespaces.Reset();
+			CurrentSourceDownloadOffset = 0;
+			CurrentSourceDownloadTotalCount = 0;
+			bVerifySourceDownloadCheckpoint = false;
+			break;
+		}
+
+		CurrentSourceDownloadOffset = Page.Offset + Page.Limit;
+		CurrentSourceDownloadTotalCount = Page.TotalCount;
+		bVerifySourceDownloadCheckpoint = true;
+	}
+
+	if (bVerifySourceDownloadCheckpoint)
+	{
+		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Resuming run %s from %d checkpointed pages, at offset %d"),
+			*SourceDownloadCheckpoint.GetRunId(), SourceDownloadCheckpoint.GetPages().Num(), CurrentSourceDownloadOffset);
+	}
+
+	const FString Url = FGridlyApi::GetRecordsUrl(ViewId, CurrentSourceDownloadOffset, CurrentSourceDownloadLimit, ColumnIds);
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FGridlyApi::CreateRequest(TEXT("GET"), Url, ApiKey);
+
 	HttpRequest->OnProcessRequestComplete().BindRaw(this, &FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly);
-	HttpRequest->ProcessRequest();
+	CurrentSourceDownloadRequest = HttpRequest;
+	FGridlyApi::ProcessRequest(HttpRequest);
+	bSourceDownloadInProgress = true;
 
 	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("🔄 Downloading source changes from Gridly for target: %s, culture: %s (paginated)"), 
 		*LocalizationTarget->Settings.Name, *NativeCulture);
+	return true;
 }
 
 void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 {
+	GRIDLY_PERF_HTTP(SourceChanges, Request, Response);
+
+	// Only requesting another page keeps the download in progress
+	bSourceDownloadInProgress = false;
+	CurrentSourceDownloadRequest.Reset();
+
 	if (!bSuccess || !Response.IsValid())
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ Failed to download source changes from Gridly"));
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ Failed to download source changes from Gridly. Please check your API key and view ID.")));
+		bSourceDownloadFailed = true;
+		if (SourceChangesJob.IsValid())
+		{
+			SourceChangesJob->Fail(LOCTEXT("GridlySourceChangesDownloadFailed",
+				"Failed to download source changes from Gridly. Please check your API key and view ID."));
+			SourceChangesJob.Reset();
+		}
 		return;
 	}
 
-	const FString ResponseContent = Response->GetContentAsString();
+	const FString ResponseContent = FGridlyApi::GetContentAsString(Response);
+
+	// Checkpointed pages are only kept if the view still has as many records as when they were downloaded
+	if (bVerifySourceDownloadCheckpoint)
+	{
+		bVerifySourceDownloadCheckpoint = false;
+
+		const FString ViewId = GetMutableDefault<UGridlyGameSettings>()->ImportFromViewIds[0];
+		const FString TotalCountHeader = Response->GetHeader(TEXT("X-Total-Count"));
+		if (!TotalCountHeader.IsEmpty() && !SourceDownloadCheckpoint.IsConsistent(ViewId, FCString::Atoi(*TotalCountHeader))
+			&& CurrentSourceDownloadTarget.IsValid())
+		{
+			UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("⚠️ View %s changed since it was checkpointed, starting over"), *ViewId);
+			SourceDownloadCheckpoint.Discard();
+
+			const FString NativeCulture = CurrentSourceDownloadCulture;
+			DownloadSourceChangesFromGridlyInternal(CurrentSourceDownloadTarget, NativeCulture);
+			return;
+		}
+	}
 
 	// Total count from Gridly (for pagination)
 	if (CurrentSourceDownloadTotalCount <= 0)
@@ -1272,29 +1881,124 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 		}
 	}
 
-	// Parse the JSON response to get the records for this page
-	TArray<TSharedPtr<FJsonValue>> RecordsArray;
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-
-	if (!FJsonSerializer::Deserialize(JsonReader, RecordsArray))
+	int32 NumPageRecords = 0;
+	if (!AccumulateSourceChangesPage(ResponseContent, NumPageRecords))
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ Failed to parse JSON response from Gridly"));
-		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("❌ Failed to parse response from Gridly.")));
+		bSourceDownloadFailed = true;
+		if (SourceChangesJob.IsValid())
+		{
+			SourceChangesJob->Fail(LOCTEXT("GridlySourceChangesParseFailed", "Failed to parse response from Gridly."));
+			SourceChangesJob.Reset();
+		}
 		return;
 	}
 
 	// Empty page is valid (e.g. last page)
-	if (RecordsArray.Num() == 0 && AccumulatedSourceDownloadNamespaceRecords.Num() == 0)
+	if (NumPageRecords == 0 && AccumulatedSourceDownloadNamespaceRecords.Num() == 0 && SpilledSourceDownloadNamespaces.Num() == 0)
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("⚠️ No records returned from Gridly"));
-		ProcessSourceChangesForNamespaces(AccumulatedSourceDownloadNamespaceRecords);
+		SourceDownloadCheckpoint.Complete();
+		BeginApplySourceChanges();
+		return;
+	}
+
+	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
+	const FString ViewId = GameSettings->ImportFromViewIds[0];
+	SourceDownloadCheckpoint.AddPage(0, ViewId, CurrentSourceDownloadOffset, CurrentSourceDownloadLimit, CurrentSourceDownloadTotalCount,
+		ResponseContent);
+
+	const int32 NextOffset = CurrentSourceDownloadOffset + CurrentSourceDownloadLimit;
+	// Fetch next page if we got a full page and (we don't know total, or total is beyond next offset)
+	const bool bHasMore = (NumPageRecords >= CurrentSourceDownloadLimit) && (CurrentSourceDownloadTotalCount <= 0 || NextOffset < CurrentSourceDownloadTotalCount);
+
+	if (bHasMore)
+	{
+		SourceDownloadBatchSizer.AddSample(NumPageRecords, Response->GetContent().Num(), Request.IsValid() ? Request->GetElapsedTime() : 0.0);
+		CurrentSourceDownloadOffset = NextOffset;
+		CurrentSourceDownloadLimit = SourceDownloadBatchSizer.GetBatchSize();
+		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Fetching next page (offset %d, total %d)"), CurrentSourceDownloadOffset, CurrentSourceDownloadTotalCount);
+		if (SourceChangesJob.IsValid())
+		{
+			SourceChangesJob->SetProgress(FText::Format(LOCTEXT("GridlySourceChangesProgress", "{0} of {1} records downloaded"),
+				CurrentSourceDownloadOffset, CurrentSourceDownloadTotalCount));
+		}
+
+		const FString Url = FGridlyApi::GetRecordsUrl(ViewId, CurrentSourceDownloadOffset, CurrentSourceDownloadLimit,
+			FGridlyApi::GetTextColumnIds({ CurrentSourceDownloadCulture }, {}));
+
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+			FGridlyApi::CreateRequest(TEXT("GET"), Url, GameSettings->ImportApiKey);
+		HttpRequest->OnProcessRequestComplete().BindRaw(this, &FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly);
+		CurrentSourceDownloadRequest = HttpRequest;
+		FGridlyApi::ProcessRequest(HttpRequest);
+		bSourceDownloadInProgress = true;
 		return;
 	}
 
+	// All pages fetched — generate CSV files and update string tables for all namespaces
+	TSet<int32> FetchedNamespaces = SpilledSourceDownloadNamespaces;
+	for (const auto& Pair : AccumulatedSourceDownloadNamespaceRecords)
+	{
+		FetchedNamespaces.Add(Pair.Key);
+	}
+	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Fetched %d namespaces from %d total records"), FetchedNamespaces.Num(), CurrentSourceDownloadTotalCount);
+	SourceDownloadCheckpoint.Complete();
+	BeginApplySourceChanges();
+}
+
+namespace GridlySourceChanges
+{
+	static int64 GetAllocatedSize(const TArray<FGridlyLocalizationServiceProvider::FGridlySourceRecord>& Records)
+	{
+		int64 Bytes = Records.GetAllocatedSize();
+		for (const FGridlyLocalizationServiceProvider::FGridlySourceRecord& Record : Records)
+		{
+			Bytes += Record.RecordId.GetAllocatedSize() + Record.SourceText.GetAllocatedSize();
+		}
+
+		return Bytes;
+	}
+
+	static void AppendCSVRows(FString& CSVContent, const TArray<FGridlyLocalizationServiceProvider::FGridlySourceRecord>& Records)
+	{
+		for (const FGridlyLocalizationServiceProvider::FGridlySourceRecord& Record : Records)
+		{
+			// Escape quotes in the source text
+			FString EscapedSourceText = Record.SourceText;
+			EscapedSourceText = EscapedSourceText.Replace(TEXT("\""), TEXT("\"\""));
+			
+			CSVContent += FString::Printf(TEXT("\"%s\",\"%s\"\n"), *Record.RecordId, *EscapedSourceText);
+		}
+	}
+}
+
+bool FGridlyLocalizationServiceProvider::AccumulateSourceChangesPage(const FString& Content, int32& OutNumRecords)
+{
+	// Parse the JSON response to get the records for this page
+	TArray<TSharedPtr<FJsonValue>> RecordsArray;
+	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
+
+	bool bParsed;
+	{
+		GRIDLY_PERF_SCOPE(SourceChanges, Parse);
+		bParsed = FJsonSerializer::Deserialize(JsonReader, RecordsArray);
+	}
+	FGridlyPerfCounters::AddRecords(EGridlyPerfOperation::SourceChanges, RecordsArray.Num());
+
+	OutNumRecords = RecordsArray.Num();
+	if (!bParsed)
+	{
+		return false;
+	}
+
 	const UGridlyGameSettings* GameSettings = GetMutableDefault<UGridlyGameSettings>();
 
 	// Group this page's records by namespace (path column)
-	TMap<FString, TArray<FGridlySourceRecord>> PageNamespaceRecords;
+	TMap<int32, TArray<FGridlySourceRecord>> PageNamespaceRecords;
+
+	// Whether a column holds the native culture, by column ID handle, so each column ID is only converted once
+	TMap<int32, bool> NativeCultureColumns;
 
 	for (const TSharedPtr<FJsonValue>& RecordValue : RecordsArray)
 	{
@@ -1317,7 +2021,7 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 		FString Path;
 		if ((*RecordObject)->TryGetStringField(FString(TEXT("path")), Path))
 		{
-			SourceRecord.Path = Path;
+			SourceRecord.Path = SessionStrings.Intern(Path);
 		}
 
 		// Extract source text and path (namespace) from cells
@@ -1338,25 +2042,33 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 						// Path/namespace from the path column (NamespaceColumnId) — supports all paths, not just top-level path
 						if (!GameSettings->NamespaceColumnId.IsEmpty() && ColumnId == GameSettings->NamespaceColumnId)
 						{
-							SourceRecord.Path = Value;
+							SourceRecord.Path = SessionStrings.Intern(Value);
+							continue;
 						}
-						// Source language column
-						else if (ColumnId.StartsWith(GameSettings->SourceLanguageColumnIdPrefix))
+
+						const int32 ColumnHandle = SessionStrings.Intern(ColumnId);
+						bool* bIsNativeCultureColumn = NativeCultureColumns.Find(ColumnHandle);
+						if (!bIsNativeCultureColumn)
 						{
-							const FString GridlyCulture = ColumnId.RightChop(GameSettings->SourceLanguageColumnIdPrefix.Len());
-							FString Culture;
-							
-							// Convert Gridly culture to UE culture
-							if (FGridlyCultureConverter::ConvertFromGridly(TArray<FString>(), GridlyCulture, Culture))
+							bIsNativeCultureColumn = &NativeCultureColumns.Add(ColumnHandle, false);
+
+							// Source language column
+							if (ColumnId.StartsWith(GameSettings->SourceLanguageColumnIdPrefix))
 							{
-								// Check if this matches our native culture
-								if (Culture == CurrentSourceDownloadCulture)
-								{
-									SourceRecord.SourceText = Value;
-									break;
-								}
+								const FString GridlyCulture = ColumnId.RightChop(GameSettings->SourceLanguageColumnIdPrefix.Len());
+								FString Culture;
+
+								// Convert Gridly culture to UE culture, and check if this matches our native culture
+								*bIsNativeCultureColumn = FGridlyCultureConverter::ConvertFromGridly(TArray<FString>(), GridlyCulture, Culture)
+									&& Culture == CurrentSourceDownloadCulture;
 							}
 						}
+
+						if (*bIsNativeCultureColumn)
+						{
+							SourceRecord.SourceText = Value;
+							break;
+						}
 					}
 				}
 			}
@@ -1365,7 +2077,7 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 		// Only add records that have valid data
 		if (!SourceRecord.RecordId.IsEmpty() && !SourceRecord.SourceText.IsEmpty())
 		{
-			FString Namespace = SourceRecord.Path;
+			FString Namespace = SourceRecord.Path != INDEX_NONE ? SessionStrings.Resolve(SourceRecord.Path) : FString();
 			
 			// Handle combined namespace key format
 			if (GameSettings->bUseCombinedNamespaceId)
@@ -1382,7 +2094,8 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 			
 			if (!Namespace.IsEmpty())
 			{
-				PageNamespaceRecords.FindOrAdd(Namespace).Add(SourceRecord);
+				const int32 NamespaceHandle = SessionStrings.GetCaseInsensitiveHandle(SessionStrings.Intern(Namespace));
+				PageNamespaceRecords.FindOrAdd(NamespaceHandle).Add(SourceRecord);
 			}
 		}
 	}
@@ -1392,51 +2105,74 @@ void FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly(FHttp
 	{
 		TArray<FGridlySourceRecord>& Accumulated = AccumulatedSourceDownloadNamespaceRecords.FindOrAdd(Pair.Key);
 		Accumulated.Append(Pair.Value);
+		AccumulatedSourceDownloadBytes += GridlySourceChanges::GetAllocatedSize(Pair.Value);
 	}
 
-	const int32 Limit = FMath::Clamp(GameSettings->ImportMaxRecordsPerRequest, 1, 1000);
-	const int32 NextOffset = CurrentSourceDownloadOffset + Limit;
-	// Fetch next page if we got a full page and (we don't know total, or total is beyond next offset)
-	const bool bHasMore = (RecordsArray.Num() >= Limit) && (CurrentSourceDownloadTotalCount <= 0 || NextOffset < CurrentSourceDownloadTotalCount);
-
-	if (bHasMore)
+	// Past the memory budget, records wait in their namespaces' CSV files instead
+	const int64 MemoryBudgetBytes = static_cast<int64>(FMath::Max(0, GameSettings->DownloadMemoryBudgetMB)) * 1024 * 1024;
+	if (MemoryBudgetBytes > 0 && AccumulatedSourceDownloadBytes > MemoryBudgetBytes)
 	{
-		CurrentSourceDownloadOffset = NextOffset;
-		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Fetching next page (offset %d, total %d)"), CurrentSourceDownloadOffset, CurrentSourceDownloadTotalCount);
+		SpillSourceChangeRecords();
+	}
 
-		const FString ViewId = GameSettings->ImportFromViewIds[0];
-		const FString PaginationSettings = FGenericPlatformHttp::UrlEncode(FString::Printf(TEXT("{\"offset\":%d,\"limit\":%d}"), CurrentSourceDownloadOffset, Limit));
-		const FString Url = FString::Printf(TEXT("https://api.gridly.com/v1/views/%s/records?page=%s"), *ViewId, *PaginationSettings);
+	return true;
+}
 
-		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-		HttpRequest->SetVerb(TEXT("GET"));
-		HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("ApiKey %s"), *GameSettings->ImportApiKey));
-		HttpRequest->SetURL(Url);
-		HttpRequest->OnProcessRequestComplete().BindRaw(this, &FGridlyLocalizationServiceProvider::OnDownloadSourceChangesFromGridly);
-		HttpRequest->ProcessRequest();
+void FGridlyLocalizationServiceProvider::SpillSourceChangeRecords()
+{
+	if (!CurrentSourceDownloadTarget.IsValid())
+	{
 		return;
 	}
 
-	// All pages fetched — generate CSV files and update string tables for all namespaces
-	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Fetched %d namespaces from %d total records"), AccumulatedSourceDownloadNamespaceRecords.Num(), CurrentSourceDownloadTotalCount);
-	ProcessSourceChangesForNamespaces(AccumulatedSourceDownloadNamespaceRecords);
+	const FString TempDir = GetSourceChangesDirectory(CurrentSourceDownloadTarget.Get());
+	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📥 Source changes exceed the memory budget, moving %d namespaces to: %s"),
+		AccumulatedSourceDownloadNamespaceRecords.Num(), *TempDir);
+
+	GRIDLY_PERF_SCOPE(SourceChanges, FileWrite);
+	for (auto It = AccumulatedSourceDownloadNamespaceRecords.CreateIterator(); It; ++It)
+	{
+		// The first records of a namespace replace any CSV file left by an earlier download
+		const bool bAppend = SpilledSourceDownloadNamespaces.Contains(It.Key());
+		FString CSVContent = bAppend ? FString() : FString(TEXT("Key,SourceString\n"));
+		GridlySourceChanges::AppendCSVRows(CSVContent, It.Value());
+
+		const FString CSVFilePath = TempDir / FString::Printf(TEXT("%s.csv"), *SessionStrings.Resolve(It.Key()));
+		if (!FFileHelper::SaveStringToFile(CSVContent, *CSVFilePath,
+			bAppend ? FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM : FFileHelper::EEncodingOptions::ForceUTF8,
+			&IFileManager::Get(), bAppend ? FILEWRITE_Append : FILEWRITE_None))
+		{
+			UE_LOG(LogGridlyLocalizationServiceProvider, Warning, TEXT("⚠️ Failed to write CSV file, keeping its records in memory: %s"), *CSVFilePath);
+			continue;
+		}
+
+		SpilledSourceDownloadNamespaces.Add(It.Key());
+		AccumulatedSourceDownloadBytes -= GridlySourceChanges::GetAllocatedSize(It.Value());
+		It.RemoveCurrent();
+	}
+}
+
+FString FGridlyLocalizationServiceProvider::GetSourceChangesDirectory(const ULocalizationTarget* LocalizationTarget)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Temp") / TEXT("GridlySourceChanges") / LocalizationTarget->Settings.Name;
 }
 
-void FGridlyLocalizationServiceProvider::ProcessSourceChangesForNamespaces(const TMap<FString, TArray<FGridlySourceRecord>>& NamespaceRecords)
+void FGridlyLocalizationServiceProvider::BeginApplySourceChanges()
 {
 	if (!CurrentSourceDownloadTarget.IsValid())
 	{
 		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("Invalid localization target for source changes processing"));
+		bSourceDownloadFailed = true;
+		if (SourceChangesJob.IsValid())
+		{
+			SourceChangesJob->Fail(LOCTEXT("GridlySourceChangesInvalidTarget", "The localization target is no longer valid"));
+			SourceChangesJob.Reset();
+		}
 		return;
 	}
 
-	ULocalizationTarget* LocalizationTarget = CurrentSourceDownloadTarget.Get();
-	const FString TargetName = LocalizationTarget->Settings.Name;
-	
 	// Create temporary directory for CSV files
-	const FString TempDir = FPaths::ProjectSavedDir() / TEXT("Temp") / TEXT("GridlySourceChanges") / TargetName;
+	const FString TempDir = GetSourceChangesDirectory(CurrentSourceDownloadTarget.Get());
 	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
 	
 	if (!PlatformFile.DirectoryExists(*TempDir))
@@ -1444,52 +2180,132 @@ void FGridlyLocalizationServiceProvider::ProcessSourceChangesForNamespaces(const
 		PlatformFile.CreateDirectoryTree(*TempDir);
 	}
 
-	int32 ProcessedNamespaces = 0;
-	int32 TotalNamespaces = NamespaceRecords.Num();
+	// Namespaces moved to disk during the download may have no records left in memory
+	AccumulatedSourceDownloadNamespaceRecords.GenerateKeyArray(PendingSourceChangeNamespaces);
+	for (const int32 NamespaceHandle : SpilledSourceDownloadNamespaces)
+	{
+		if (!AccumulatedSourceDownloadNamespaceRecords.Contains(NamespaceHandle))
+		{
+			PendingSourceChangeNamespaces.Add(NamespaceHandle);
+		}
+	}
+
+	NumAppliedSourceChangeNamespaces = 0;
 
-	for (const auto& NamespacePair : NamespaceRecords)
+	if (PendingSourceChangeNamespaces.Num() == 0 && SourceChangesJob.IsValid())
 	{
-		const FString& Namespace = NamespacePair.Key;
-		const TArray<FGridlySourceRecord>& Records = NamespacePair.Value;
+		SourceChangesJob->Complete(LOCTEXT("GridlySourceChangesNoRecords", "No records returned from Gridly"));
+		SourceChangesJob.Reset();
+	}
+}
 
-		ProcessedNamespaces++;
-		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📊 Processing namespace %d/%d: %s (%d records)"), 
-			ProcessedNamespaces, TotalNamespaces, *Namespace, Records.Num());
+void FGridlyLocalizationServiceProvider::TickApplySourceChanges()
+{
+	if (PendingSourceChangeNamespaces.Num() == 0)
+	{
+		return;
+	}
 
-		// Generate CSV content
-		FString CSVContent = TEXT("Key,SourceString\n");
-		
-		for (const FGridlySourceRecord& Record : Records)
+	ULocalizationTarget* LocalizationTarget = CurrentSourceDownloadTarget.Get();
+	if (!LocalizationTarget)
+	{
+		PendingSourceChangeNamespaces.Reset();
+		bSourceDownloadFailed = true;
+		if (SourceChangesJob.IsValid())
 		{
-			// Escape quotes in the source text
-			FString EscapedSourceText = Record.SourceText;
-			EscapedSourceText = EscapedSourceText.Replace(TEXT("\""), TEXT("\"\""));
-			
-			CSVContent += FString::Printf(TEXT("\"%s\",\"%s\"\n"), *Record.RecordId, *EscapedSourceText);
+			SourceChangesJob->Fail(LOCTEXT("GridlySourceChangesInvalidTarget", "The localization target is no longer valid"));
+			SourceChangesJob.Reset();
 		}
+		return;
+	}
 
-		// Write CSV file
-		const FString CSVFilePath = TempDir / FString::Printf(TEXT("%s.csv"), *Namespace);
-		
-		if (FFileHelper::SaveStringToFile(CSVContent, *CSVFilePath))
-		{
-			UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("✅ Generated CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
-			
-			// Import the CSV into the string table
-			ImportCSVToStringTable(LocalizationTarget, Namespace, CSVFilePath);
-		}
-		else
+	// String tables are only touched on the game thread, so namespaces are applied until the frame's budget is used up
+	const double MaxSecondsPerTick = 0.008;
+	const double EndTime = FPlatformTime::Seconds() + MaxSecondsPerTick;
+	do
+	{
+		const int32 NamespaceHandle = PendingSourceChangeNamespaces[0];
+		PendingSourceChangeNamespaces.RemoveAt(0);
+		ApplySourceChangesForNamespace(LocalizationTarget, NamespaceHandle);
+	}
+	while (PendingSourceChangeNamespaces.Num() > 0 && FPlatformTime::Seconds() < EndTime);
+
+	if (PendingSourceChangeNamespaces.Num() > 0)
+	{
+		if (SourceChangesJob.IsValid())
 		{
-			UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ Failed to write CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
+			SourceChangesJob->SetProgress(FText::Format(LOCTEXT("GridlySourceChangesApplyProgress", "{0} of {1} string tables updated"),
+				NumAppliedSourceChangeNamespaces, NumAppliedSourceChangeNamespaces + PendingSourceChangeNamespaces.Num()));
 		}
+		return;
 	}
 
 	// Show completion message
+	const FString TempDir = GetSourceChangesDirectory(LocalizationTarget);
 	FString Message = FString::Printf(TEXT("✅ Source changes processing completed!\n\n📊 Processed %d namespaces\n📁 CSV files saved to: %s\n\n🎉 String tables updated!\n• Source strings have been imported directly into string table assets\n• String table UI should now show the updated/new entries\n• String tables are marked as modified and need to be saved\n\n📝 Next Steps:\n• Review changes in the string table editor\n• Save the modified string table assets\n• Run 'Gather Text' from the Localization Dashboard to update manifest files\n• Commit changes to version control\n\n⚠️ Note: This feature modifies source strings. Review changes before committing."), 
-		ProcessedNamespaces, *TempDir);
+		NumAppliedSourceChangeNamespaces, *TempDir);
 	
 	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("%s"), *Message);
-	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
+	if (SourceChangesJob.IsValid())
+	{
+		SourceChangesJob->AddMessage(EMessageSeverity::Info, FText::FromString(Message));
+		SourceChangesJob->Complete(FText::Format(LOCTEXT("GridlySourceChangesApplied",
+			"Updated the string tables of {0} namespaces, review and save them"), NumAppliedSourceChangeNamespaces));
+		SourceChangesJob.Reset();
+	}
+
+	// The downloaded records are no longer needed
+	AccumulatedSourceDownloadNamespaceRecords.Reset();
+	AccumulatedSourceDownloadBytes = 0;
+	SpilledSourceDownloadNamespaces.Reset();
+}
+
+void FGridlyLocalizationServiceProvider::ApplySourceChangesForNamespace(ULocalizationTarget* LocalizationTarget, int32 NamespaceHandle)
+{
+	static const TArray<FGridlySourceRecord> NoRecords;
+
+	const FString TempDir = GetSourceChangesDirectory(LocalizationTarget);
+	const FString& Namespace = SessionStrings.Resolve(NamespaceHandle);
+	const TArray<FGridlySourceRecord>* FoundRecords = AccumulatedSourceDownloadNamespaceRecords.Find(NamespaceHandle);
+	const TArray<FGridlySourceRecord>& Records = FoundRecords ? *FoundRecords : NoRecords;
+	const bool bSpilled = SpilledSourceDownloadNamespaces.Contains(NamespaceHandle);
+
+	NumAppliedSourceChangeNamespaces++;
+	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📊 Processing namespace %d/%d: %s (%d records)"), 
+		NumAppliedSourceChangeNamespaces, NumAppliedSourceChangeNamespaces + PendingSourceChangeNamespaces.Num(), *Namespace, Records.Num());
+
+	// Generate CSV content, after the records already in the file when they were moved to disk
+	FString CSVContent = bSpilled ? FString() : FString(TEXT("Key,SourceString\n"));
+	GridlySourceChanges::AppendCSVRows(CSVContent, Records);
+
+	// Write CSV file
+	const FString CSVFilePath = TempDir / FString::Printf(TEXT("%s.csv"), *Namespace);
+	bool bSavedCSV;
+	{
+		GRIDLY_PERF_SCOPE(SourceChanges, FileWrite);
+		bSavedCSV = bSpilled
+			? FFileHelper::SaveStringToFile(CSVContent, *CSVFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+				&IFileManager::Get(), FILEWRITE_Append)
+			: FFileHelper::SaveStringToFile(CSVContent, *CSVFilePath);
+	}
+	
+	if (bSavedCSV)
+	{
+		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("✅ Generated CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
+		
+		// Import the CSV into the string table
+		GRIDLY_PERF_SCOPE(SourceChanges, StringTableApply);
+		ImportCSVToStringTable(LocalizationTarget, Namespace, CSVFilePath);
+	}
+	else
+	{
+		UE_LOG(LogGridlyLocalizationServiceProvider, Error, TEXT("❌ Failed to write CSV file for namespace '%s': %s"), *Namespace, *CSVFilePath);
+		if (SourceChangesJob.IsValid())
+		{
+			SourceChangesJob->AddMessage(EMessageSeverity::Error, FText::Format(LOCTEXT("GridlySourceChangesWriteFailed",
+				"Failed to write CSV file for namespace '{0}': {1}"), FText::FromString(Namespace), FText::FromString(CSVFilePath)));
+		}
+	}
 }
 
 bool FGridlyLocalizationServiceProvider::ImportCSVToStringTable(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& CSVFilePath)
@@ -1767,20 +2583,26 @@ bool FGridlyLocalizationServiceProvider::ImportKeyValuePairsToStringTable(ULocal
 	int32 ImportedCount = 0;
 	int32 UpdatedCount = 0;
 	int32 CreatedCount = 0;
+	int32 UnchangedCount = 0;
+
+	// Use the string table's mutable interface to set source strings
+	FStringTable& MutableStringTable = StringTable->GetMutableStringTable().Get();
 
 	for (const auto& KeyValuePair : KeyValuePairs)
 	{
 		const FString& Key = KeyValuePair.Key;
 		const FString& Value = KeyValuePair.Value;
 
-		// Use the string table's mutable interface to set source strings
-		FStringTable& MutableStringTable = StringTable->GetMutableStringTable().Get();
-		
 		// Check if entry already exists
 		FString ExistingValue;
 		bool bExists = MutableStringTable.GetSourceString(Key, ExistingValue);
 		
-		if (bExists)
+		if (bExists && ExistingValue.Equals(Value, ESearchCase::CaseSensitive))
+		{
+			// Leave identical entries alone so untouched tables are not dirtied
+			UnchangedCount++;
+		}
+		else if (bExists)
 		{
 			// Update existing entry
 			MutableStringTable.SetSourceString(Key, Value);
@@ -1798,24 +2620,41 @@ bool FGridlyLocalizationServiceProvider::ImportKeyValuePairsToStringTable(ULocal
 		ImportedCount++;
 	}
 
-	// Mark the string table as modified and save it
-	StringTable->Modify(true);
-	StringTable->MarkPackageDirty();
-	
-	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("💾 String table marked as dirty and modified: %s"), *StringTable->GetPathName());
-	
-	// Mark the string table as modified (user will save manually)
-	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("📝 String table marked as modified: %s"), *StringTable->GetPathName());
-	
-	// Mark the asset as dirty so user knows it needs saving
-	StringTable->MarkPackageDirty();
+	if (UpdatedCount + CreatedCount > 0)
+	{
+		// Mark the string table as modified (user will save manually, the commandlet saves the touched tables itself)
+		StringTable->Modify(true);
+		StringTable->MarkPackageDirty();
+		TouchedStringTables.Add(StringTable);
+
+		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("💾 String table marked as dirty and modified: %s"), *StringTable->GetPathName());
+	}
+	else
+	{
+		UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("✅ String table already up to date: %s"), *StringTable->GetPathName());
+	}
 
-	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("✅ Imported %d/%d entries for namespace '%s' (%d updated, %d created)"), 
-		ImportedCount, KeyValuePairs.Num(), *Namespace, UpdatedCount, CreatedCount);
+	UE_LOG(LogGridlyLocalizationServiceProvider, Log, TEXT("✅ Imported %d/%d entries for namespace '%s' (%d updated, %d created, %d unchanged)"), 
+		ImportedCount, KeyValuePairs.Num(), *Namespace, UpdatedCount, CreatedCount, UnchangedCount);
 	
 	return true;
 }
 
+TArray<UStringTable*> FGridlyLocalizationServiceProvider::ConsumeTouchedStringTables()
+{
+	TArray<UStringTable*> StringTables;
+	for (const TWeakObjectPtr<UStringTable>& StringTable : TouchedStringTables)
+	{
+		if (StringTable.IsValid())
+		{
+			StringTables.Add(StringTable.Get());
+		}
+	}
+
+	TouchedStringTables.Reset();
+	return StringTables;
+}
+
 UStringTable* FGridlyLocalizationServiceProvider::FindOrCreateStringTable(const FString& Namespace)
 {
 	// Try to find existing string table
@@ -4,26 +4,37 @@
 
 #include "CoreMinimal.h"
 
+#include "GridlyBatchSizer.h"
+#include "GridlyCancellationToken.h"
+#include "GridlyDownloadCheckpoint.h"
+#include "GridlyInternTable.h"
 #include "ILocalizationServiceOperation.h"
 #include "ILocalizationServiceProvider.h"
 #include "ILocalizationServiceState.h"
 #include "Interfaces/IHttpRequest.h"
+#include "LocalizationCommandletExecution.h"
 #include <string>
 #include <fstream>
 #include <iostream>
 
+class FDownloadLocalizationTargetFile;
+class FGridlyBackgroundJob;
+class FLocTextHelper;
+struct FPolyglotTextData;
+class UGridlyTask_DownloadLocalizedTexts;
+class UStringTable;
 
 class FGridlyLocalizationServiceProvider final : public ILocalizationServiceProvider
 {
-
-
+public:
+	/** Record ID and path as SessionStrings handles, so the sync diff compares integers */
 	class FGridlyTypeRecord
 	{
 	public:
-		FString Id;
-		FString Path;
+		int32 Id;
+		int32 Path;
 
-		FGridlyTypeRecord(const FString& InId, const FString& InPath)
+		FGridlyTypeRecord(int32 InId, int32 InPath)
 			: Id(InId), Path(InPath)
 		{}
 	};
@@ -32,11 +43,11 @@ class FGridlyLocalizationServiceProvider final : public ILocalizationServiceProv
 	{
 	public:
 		FString RecordId;
-		FString Path;
+		int32 Path; // SessionStrings handle, INDEX_NONE when the record has no path
 		FString SourceText;
 
 		FGridlySourceRecord()
-			: RecordId(TEXT("")), Path(TEXT("")), SourceText(TEXT(""))
+			: RecordId(TEXT("")), Path(INDEX_NONE), SourceText(TEXT(""))
 		{}
 	};
 public:
@@ -45,6 +56,8 @@ public:
 	
 	// Manifest handling functions
 	bool ImportKeyValuePairsToStringTable(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const TMap<FString, FString>& KeyValuePairs);
+	/** Returns the string tables created or modified by ImportKeyValuePairsToStringTable since the last call, and forgets them */
+	TArray<UStringTable*> ConsumeTouchedStringTables();
 	bool HasDeleteRequestsPending() const;
 
 public:
@@ -67,10 +80,26 @@ public:
 		ELocalizationServiceOperationConcurrency::Type InConcurrency = ELocalizationServiceOperationConcurrency::Synchronous,
 		const FLocalizationServiceOperationComplete& InOperationCompleteDelegate =
 		FLocalizationServiceOperationComplete()) override;
+	/** Downloads the texts once and writes the .po file of every operation from them, then completes each operation */
+	void ExecuteDownloads(const TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>>& DownloadOperations,
+		const FLocalizationServiceOperationComplete& InOperationCompleteDelegate);
+	/** Content hash of a .po file written by ExecuteDownloads, or an empty string */
+	FString GetPoFileContentHash(const FString& AbsoluteFilePathAndName) const { return PoFileContentHashes.FindRef(AbsoluteFilePathAndName); }
+	/** Writes the target's import config for the .po files below DirectoryPath without ExcludedCultures, and returns its path */
+	static FString GenerateImportTextConfigFile(ULocalizationTarget* LocalizationTarget, const FString& DirectoryPath,
+		const TArray<FString>& ExcludedCultures);
+	/**
+	 * Cultures of the target, other than the native one, that are not in CulturesToImport. Besides unchanged cultures these are
+	 * the ones whose download failed, so that no .po file left over from an earlier run is imported for them.
+	 */
+	static TArray<FString> GetCulturesExcludedFromImport(const ULocalizationTarget* LocalizationTarget,
+		const TMap<FString, FString>& CulturesToImport);
 	virtual bool CanCancelOperation(
 		const TSharedRef<ILocalizationServiceOperation, ESPMode::ThreadSafe>& InOperation) const override;
 	virtual void CancelOperation(const TSharedRef<ILocalizationServiceOperation, ESPMode::ThreadSafe>& InOperation) override;
 	virtual void Tick() override;
+	/** Stops all Gridly work in flight: requests are aborted, queued requests dropped and .po writers stopped */
+	void CancelAll();
 
 #if LOCALIZATION_SERVICES_WITH_SLATE
 	virtual void CustomizeSettingsDetails(IDetailCategoryBuilder& DetailCategoryBuilder) const override;
@@ -87,8 +116,16 @@ public:
 	// functions to run export/import from commandlet
 	FHttpRequestCompleteDelegate CreateExportNativeCultureDelegate();
 	bool HasRequestsPending() const;
+	/** Entries Gridly reported as created or updated by the last export */
+	uint64 GetNumExportedEntries() const { return ExportForTargetEntriesUpdated; }
 
-	void ExportForTargetToGridly(ULocalizationTarget* LocalizationTarget, FHttpRequestCompleteDelegate& ReqDelegate, const FText& SlowTaskText, bool bIncTargetTranslation = false);
+	void ExportForTargetToGridly(ULocalizationTarget* LocalizationTarget, FHttpRequestCompleteDelegate& ReqDelegate, const FText& JobTitle, bool bIncTargetTranslation = false);
+	/**
+	 * Uploads texts in chunks of at most ExportMaxRecordsPerRequest, one request at a time, and remembers them for the sync.
+	 * In the editor the chunks are converted to JSON on a worker thread and the upload runs behind a progress toast.
+	 */
+	void ExportPolyglotTextDatasToGridly(TArray<FPolyglotTextData> PolyglotTextDatas, const TSharedPtr<FLocTextHelper>& LocTextHelperPtr,
+		FHttpRequestCompleteDelegate& ReqDelegate, const FText& JobTitle, bool bIncTargetTranslation = false);
 
 	// New functions for fetching and parsing CSV from Gridly
 	void FetchGridlyCSV(); // Fetches the CSV data from Gridly
@@ -96,23 +133,62 @@ public:
 	void ParseCSVAndCreateRecords(const FString& CSVContent); // Parses CSV content and creates records
 
 private:
+	// Cancellation
+
+	/** Shared by the work started since the last CancelAll */
+	FGridlyCancellationToken CancellationToken;
+
+	/** A download started by ExecuteDownloads that has not finished, and the operations it serves */
+	struct FActiveDownload
+	{
+		TWeakObjectPtr<UGridlyTask_DownloadLocalizedTexts> Task;
+		TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>> Operations;
+	};
+	TArray<FActiveDownload> ActiveDownloads;
+	int32 FindActiveDownload(const ILocalizationServiceOperation& Operation) const;
+
+	/** Completes the operations of a download once its .po files were written, on the game thread */
+	void CompleteDownloads(const TArray<TSharedRef<FDownloadLocalizationTargetFile, ESPMode::ThreadSafe>>& DownloadOperations,
+		const FLocalizationServiceOperationComplete& InOperationCompleteDelegate, const TArray<FString>& AbsoluteFilePathAndNames,
+		const TArray<bool>& WriteResults, const TArray<FString>& ContentHashes, const FGridlyCancellationToken& DownloadCancellationToken);
+
+	/** Set while CancelAll runs, so the operations it fails are not reported as errors */
+	bool bCancelling = false;
+
 	// Import
 	bool IsFileNotEmpty(const std::string& filePath);
 	void ImportAllCulturesForTargetFromGridly(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, bool bIsTargetSet);
 	void OnImportCultureForTargetFromGridly(const FLocalizationServiceOperationRef& Operation,
 		ELocalizationServiceOperationCommandResult::Type Result, bool bIsTargetSet);
-	TSharedPtr<FScopedSlowTask> ImportAllCulturesForTargetFromGridlySlowTask;
+	TSharedPtr<FGridlyBackgroundJob> ImportJob;
+	/** Import and report commandlets of the current import, run one after another from Tick so the editor stays usable */
+	TArray<LocalizationCommandletExecution::FTask> PendingImportTasks;
+	TSharedPtr<FLocalizationCommandletProcess> RunningImportProcess;
+	FText RunningImportTaskName;
+	FString RunningImportTaskScriptPath;
+	FString ImportTasksScriptPath;
+	TWeakObjectPtr<ULocalizationTarget> ImportTasksTarget;
+	TMap<FString, FString> ImportTasksCultureHashes;
+	bool bImportTasksFailed = false;
+	void TickImportTasks();
+	void FinishImportTasks();
 	TArray<FString> CurrentCultureDownloads;
 	int SuccessfulDownloads;
+	/** Content hash of each culture downloaded by the current import, to skip cultures that did not change */
+	TMap<FString, FString> DownloadedCultureHashes;
+	TMap<FString, FString> PoFileContentHashes;
 	size_t ExportForTargetEntriesDeleted = 0;
 
 
 	// Export
 
 	size_t ExportForTargetEntriesUpdated;
-	TSharedPtr<FScopedSlowTask> ExportForTargetToGridlySlowTask;
+	TSharedPtr<FGridlyBackgroundJob> ExportJob;
 	TQueue<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> ExportFromTargetRequestQueue;
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> CurrentExportRequest;
 	bool bExportRequestInProgress = false;
+	/** Queues one request per JSON payload and sends the first */
+	void StartExportRequests(const TArray<FString>& Payloads, const FHttpRequestCompleteDelegate& ReqDelegate);
 
 	void ExportNativeCultureForTargetToGridly(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, bool bIsTargetSet);
 	void OnExportNativeCultureForTargetToGridly(FHttpRequestPtr HttpRequestPtr, FHttpResponsePtr HttpResponsePtr, bool bSuccess);
@@ -129,21 +205,56 @@ public:
 
 	TArray<FGridlyTypeRecord> GridlyRecords; // List to store the records from Gridly
 	TArray<FGridlyTypeRecord> UERecords;
+	/** Namespaces, paths, record IDs and column IDs seen this session, shared by the records above */
+	FGridlyInternTable SessionStrings;
 	FString RemoveNamespaceFromKey(FString& InputString);
 	
 	void DeleteRecordsFromGridly(const TArray<FString>& RecordsToDelete);
 	void OnDeleteRecordsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+	/** CSV fetch and delete batch requests of the sync that have not completed */
+	TArray<FHttpRequestPtr> PendingSyncRequests;
+	TSharedPtr<FGridlyBackgroundJob> SyncJob;
 
 	// Source changes download tracking
 	TWeakObjectPtr<ULocalizationTarget> CurrentSourceDownloadTarget;
 	FString CurrentSourceDownloadCulture;
-	/** Pagination: accumulated records across pages so we get all namespaces */
-	TMap<FString, TArray<FGridlySourceRecord>> AccumulatedSourceDownloadNamespaceRecords;
+	FHttpRequestPtr CurrentSourceDownloadRequest;
+	TSharedPtr<FGridlyBackgroundJob> SourceChangesJob;
+	/** Pagination: accumulated records across pages so we get all namespaces, keyed by case-insensitive namespace handle */
+	TMap<int32, TArray<FGridlySourceRecord>> AccumulatedSourceDownloadNamespaceRecords;
 	int32 CurrentSourceDownloadOffset = 0;
 	int32 CurrentSourceDownloadTotalCount = 0;
+	/** Records requested in the current page, chosen by SourceDownloadBatchSizer */
+	int32 CurrentSourceDownloadLimit = 0;
+	FGridlyBatchSizer SourceDownloadBatchSizer;
+	FGridlyDownloadCheckpoint SourceDownloadCheckpoint;
+	/** Set while the first page after resuming from a checkpoint is outstanding */
+	bool bVerifySourceDownloadCheckpoint = false;
+	/** Estimated memory held by AccumulatedSourceDownloadNamespaceRecords, checked against DownloadMemoryBudgetMB */
+	int64 AccumulatedSourceDownloadBytes = 0;
+	/** Namespaces whose CSV file already holds records moved out of memory by this download */
+	TSet<int32> SpilledSourceDownloadNamespaces;
+	/** Set while source change pages are being downloaded, cleared once they were applied or the download failed */
+	bool bSourceDownloadInProgress = false;
+	/** Set when the last source changes download failed or was cancelled */
+	bool bSourceDownloadFailed = false;
 public:
-	void DownloadSourceChangesFromGridlyInternal(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, const FString& NativeCulture);
-	void ProcessSourceChangesForNamespaces(const TMap<FString, TArray<FGridlySourceRecord>>& NamespaceRecords);
+	/** Whether a source changes download is still fetching pages or applying them to string tables */
+	bool IsSourceDownloadPending() const { return bSourceDownloadInProgress || PendingSourceChangeNamespaces.Num() > 0; }
+	bool HasSourceDownloadFailed() const { return bSourceDownloadFailed; }
+	/** Returns false if the download could not be started, such as without an import API key or view */
+	bool DownloadSourceChangesFromGridlyInternal(TWeakObjectPtr<ULocalizationTarget> LocalizationTarget, const FString& NativeCulture);
+	/** Parses a page of source change records into AccumulatedSourceDownloadNamespaceRecords */
+	bool AccumulateSourceChangesPage(const FString& Content, int32& OutNumRecords);
+	/** Appends the accumulated records to their namespaces' CSV files and frees them */
+	void SpillSourceChangeRecords();
+	static FString GetSourceChangesDirectory(const ULocalizationTarget* LocalizationTarget);
+	/** Queues every downloaded namespace, whose CSV file and string table are then updated a few per frame from Tick */
+	void BeginApplySourceChanges();
+	void TickApplySourceChanges();
+	void ApplySourceChangesForNamespace(ULocalizationTarget* LocalizationTarget, int32 NamespaceHandle);
+	TArray<int32> PendingSourceChangeNamespaces;
+	int32 NumAppliedSourceChangeNamespaces = 0;
 	bool ImportCSVToStringTable(ULocalizationTarget* LocalizationTarget, const FString& Namespace, const FString& CSVFilePath);
 	/** Parse CSV content into logical rows; newlines inside quoted fields are preserved as part of the value */
 	void ParseCSVIntoLogicalRows(const FString& CSVContent, TArray<FString>& OutRows);
@@ -153,6 +264,9 @@ public:
 	
 	// String table helper functions
 	UStringTable* FindOrCreateStringTable(const FString& Namespace);
+
+	/** String tables whose entries were actually changed by an import */
+	TSet<TWeakObjectPtr<UStringTable>> TouchedStringTables;
 	
 
 
@@ -0,0 +1,297 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#include "GridlyMockServer.h"
+
+#include "GridlyApi.h"
+#include "GridlyCultureConverter.h"
+#include "GridlyGameSettings.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGridlyMockServer, Log, All);
+
+namespace GridlyMockServer
+{
+	static const TCHAR* Words[] = {
+		TEXT("the"), TEXT("quest"), TEXT("sword"), TEXT("village"), TEXT("dragon"), TEXT("gold"), TEXT("find"), TEXT("return"),
+		TEXT("ancient"), TEXT("door"), TEXT("shield"), TEXT("merchant"), TEXT("north"), TEXT("potion"), TEXT("castle"), TEXT("before")
+	};
+
+	/** Appends a deterministic sentence of 4 to 19 words, so payloads compress and parse like real texts */
+	void AppendSentence(FString& Out, uint32 Seed)
+	{
+		const int32 NumWords = 4 + Seed % 16;
+		for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			if (WordIndex > 0)
+			{
+				Out.AppendChar(TEXT(' '));
+			}
+			Out.Append(Words[(Seed >> 16) % UE_ARRAY_COUNT(Words)]);
+		}
+	}
+}
+
+FGridlyMockServer::FGridlyMockServer(const FGridlyMockViewSpec& InSpec)
+	: Spec(InSpec)
+{
+	const UGridlyGameSettings* GameSettings = GetDefault<UGridlyGameSettings>();
+
+	for (int32 CultureIndex = 0; CultureIndex < Spec.Cultures.Num(); CultureIndex++)
+	{
+		FString GridlyCulture;
+		if (!FGridlyCultureConverter::ConvertToGridly(Spec.Cultures[CultureIndex], GridlyCulture))
+		{
+			GridlyCulture = Spec.Cultures[CultureIndex];
+		}
+
+		const FString& Prefix = CultureIndex == 0 ? GameSettings->SourceLanguageColumnIdPrefix : GameSettings->TargetLanguageColumnIdPrefix;
+		ColumnIds.Add(Prefix + GridlyCulture);
+	}
+
+	for (int32 ColumnIndex = 0; ColumnIndex < Spec.NumOtherColumns; ColumnIndex++)
+	{
+		ColumnIds.Add(FString::Printf(TEXT("other_%d"), ColumnIndex));
+	}
+}
+
+FGridlyMockServer::~FGridlyMockServer()
+{
+	Stop();
+}
+
+bool FGridlyMockServer::Start(uint32 InPort)
+{
+	Port = InPort;
+
+	FHttpServerModule& HttpServerModule = FHttpServerModule::Get();
+	Router = HttpServerModule.GetHttpRouter(Port, true);
+	if (!Router.IsValid())
+	{
+		UE_LOG(LogGridlyMockServer, Error, TEXT("Unable to listen on port %u"), Port);
+		return false;
+	}
+
+	const FHttpPath RecordsPath(TEXT("/v1/views/:viewId/records"));
+	RouteHandles.Add(Router->BindRoute(RecordsPath, EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FGridlyMockServer::HandleGetRecords)));
+	RouteHandles.Add(Router->BindRoute(RecordsPath, EHttpServerRequestVerbs::VERB_POST,
+		FHttpRequestHandler::CreateRaw(this, &FGridlyMockServer::HandlePostRecords)));
+	RouteHandles.Add(Router->BindRoute(RecordsPath, EHttpServerRequestVerbs::VERB_DELETE,
+		FHttpRequestHandler::CreateRaw(this, &FGridlyMockServer::HandleDeleteRecords)));
+	RouteHandles.Add(Router->BindRoute(FHttpPath(TEXT("/v1/views/:viewId/export")), EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateRaw(this, &FGridlyMockServer::HandleExport)));
+
+	HttpServerModule.StartAllListeners();
+
+	UE_LOG(LogGridlyMockServer, Display, TEXT("Serving %d records in %d languages and %d namespaces at %s"), Spec.NumRecords,
+		Spec.Cultures.Num(), Spec.NumNamespaces, *GetBaseUrl());
+	return true;
+}
+
+void FGridlyMockServer::Stop()
+{
+	if (Router.IsValid())
+	{
+		for (const FHttpRouteHandle& RouteHandle : RouteHandles)
+		{
+			Router->UnbindRoute(RouteHandle);
+		}
+		RouteHandles.Empty();
+		Router.Reset();
+
+		FHttpServerModule::Get().StopAllListeners();
+	}
+}
+
+FString FGridlyMockServer::GetBaseUrl() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%u"), Port);
+}
+
+FString FGridlyMockServer::GetRecordId(int32 RecordIndex) const
+{
+	return FString::Printf(TEXT("Text_%07d"), RecordIndex);
+}
+
+FString FGridlyMockServer::GetNamespace(int32 RecordIndex) const
+{
+	return FString::Printf(TEXT("Namespace_%03d"), RecordIndex % FMath::Max(1, Spec.NumNamespaces));
+}
+
+FString FGridlyMockServer::GetText(int32 RecordIndex, int32 CultureIndex) const
+{
+	FString Text = Spec.Cultures.IsValidIndex(CultureIndex) ? Spec.Cultures[CultureIndex] + TEXT(": ") : FString();
+	GridlyMockServer::AppendSentence(Text, static_cast<uint32>(RecordIndex) * 31u + static_cast<uint32>(CultureIndex));
+	return Text;
+}
+
+FString FGridlyMockServer::GetRecordsJson(int32 Offset, int32 Limit, const TArray<FString>& RequestedColumnIds) const
+{
+	const int32 Start = FMath::Clamp(Offset, 0, Spec.NumRecords);
+	const int32 End = FMath::Clamp(Start + Limit, Start, Spec.NumRecords);
+
+	// Generated strings never need escaping, so the JSON is written directly
+	FString Json;
+	Json.Reserve((End - Start) * (64 + ColumnIds.Num() * 160));
+	Json.AppendChar(TEXT('['));
+	for (int32 RecordIndex = Start; RecordIndex < End; RecordIndex++)
+	{
+		if (RecordIndex > Start)
+		{
+			Json.AppendChar(TEXT(','));
+		}
+
+		Json.Appendf(TEXT("{\"id\":\"%s\",\"path\":\"%s\",\"cells\":["), *GetRecordId(RecordIndex), *GetNamespace(RecordIndex));
+		bool bFirstCell = true;
+		for (int32 ColumnIndex = 0; ColumnIndex < ColumnIds.Num(); ColumnIndex++)
+		{
+			if (RequestedColumnIds.Num() > 0 && !RequestedColumnIds.Contains(ColumnIds[ColumnIndex]))
+			{
+				continue;
+			}
+
+			if (!bFirstCell)
+			{
+				Json.AppendChar(TEXT(','));
+			}
+			bFirstCell = false;
+
+			Json.Appendf(TEXT("{\"columnId\":\"%s\",\"dependencyStatus\":\"upToDate\",\"value\":\"%s\"}"), *ColumnIds[ColumnIndex],
+				*GetText(RecordIndex, ColumnIndex));
+		}
+		Json.Append(TEXT("]}"));
+	}
+	Json.AppendChar(TEXT(']'));
+
+	return Json;
+}
+
+FString FGridlyMockServer::GetExportCsv() const
+{
+	FString Csv;
+	Csv.Reserve((Spec.NumRecords + Spec.NumGridlyOnlyRecords) * 40);
+	Csv.Append(TEXT("\"Record ID\",\"Path\"\n"));
+	for (int32 RecordIndex = 0; RecordIndex < Spec.NumRecords; RecordIndex++)
+	{
+		Csv.Appendf(TEXT("\"%s\",\"%s\"\n"), *GetRecordId(RecordIndex), *GetNamespace(RecordIndex));
+	}
+	for (int32 RecordIndex = 0; RecordIndex < Spec.NumGridlyOnlyRecords; RecordIndex++)
+	{
+		Csv.Appendf(TEXT("\"Removed_%07d\",\"%s\"\n"), RecordIndex, *GetNamespace(RecordIndex));
+	}
+
+	return Csv;
+}
+
+void FGridlyMockServer::ResetCounters()
+{
+	NumRequests = 0;
+	NumPostRecordsRequests = 0;
+	NumDeletedRecords = 0;
+	BytesReceived = 0;
+	BytesSent = 0;
+}
+
+bool FGridlyMockServer::HandleGetRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	int32 Offset = 0;
+	int32 Limit = GetDefault<UGridlyGameSettings>()->ImportMaxRecordsPerRequest;
+
+	if (const FString* Page = Request.QueryParams.Find(TEXT("page")))
+	{
+		TSharedPtr<FJsonObject> PageObject;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(FGenericPlatformHttp::UrlDecode(*Page));
+		if (FJsonSerializer::Deserialize(JsonReader, PageObject) && PageObject.IsValid())
+		{
+			PageObject->TryGetNumberField(TEXT("offset"), Offset);
+			PageObject->TryGetNumberField(TEXT("limit"), Limit);
+		}
+	}
+
+	TArray<FString> RequestedColumnIds;
+	if (const FString* ColumnIdsParam = Request.QueryParams.Find(TEXT("columnIds")))
+	{
+		FGenericPlatformHttp::UrlDecode(*ColumnIdsParam).ParseIntoArray(RequestedColumnIds, TEXT(","));
+	}
+
+	TUniquePtr<FHttpServerResponse> Response =
+		FHttpServerResponse::Create(GetRecordsJson(Offset, Limit, RequestedColumnIds), TEXT("application/json"));
+	Response->Headers.Add(TEXT("X-Total-Count"), { FString::FromInt(Spec.NumRecords) });
+	Complete(Request, MoveTemp(Response), OnComplete);
+	return true;
+}
+
+bool FGridlyMockServer::HandlePostRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	NumPostRecordsRequests++;
+
+	// Gridly answers with the records it created or updated, which is what the request sent. A compressed body is echoed as is
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(TArray<uint8>(Request.Body), TEXT("application/json"));
+	if (FGridlyApi::IsGzipCompressed(Request.Body))
+	{
+		Response->Headers.Add(TEXT("Content-Encoding"), { TEXT("gzip") });
+	}
+	Complete(Request, MoveTemp(Response), OnComplete);
+	return true;
+}
+
+bool FGridlyMockServer::HandleDeleteRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TArray<uint8> Body;
+	if (!FGridlyApi::IsGzipCompressed(Request.Body) || !FGridlyApi::GzipUncompress(Request.Body, Body))
+	{
+		Body = Request.Body;
+	}
+
+	const FUTF8ToTCHAR BodyString(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+	TSharedPtr<FJsonObject> BodyObject;
+	const TArray<TSharedPtr<FJsonValue>>* RecordIds;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(FString(BodyString.Length(), BodyString.Get()));
+	if (FJsonSerializer::Deserialize(JsonReader, BodyObject) && BodyObject.IsValid() && BodyObject->TryGetArrayField(TEXT("ids"), RecordIds))
+	{
+		NumDeletedRecords += RecordIds->Num();
+	}
+
+	TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+	Response->Code = EHttpServerResponseCodes::NoContent;
+	Complete(Request, MoveTemp(Response), OnComplete);
+	return true;
+}
+
+bool FGridlyMockServer::HandleExport(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	Complete(Request, FHttpServerResponse::Create(GetExportCsv(), TEXT("text/csv")), OnComplete);
+	return true;
+}
+
+void FGridlyMockServer::Complete(const FHttpServerRequest& Request, TUniquePtr<FHttpServerResponse> Response,
+	const FHttpResultCallback& OnComplete)
+{
+	// Compress like a server honoring Accept-Encoding would
+	const TArray<FString>* AcceptEncodings = Request.Headers.Find(TEXT("Accept-Encoding"));
+	const bool bAcceptsGzip = AcceptEncodings && AcceptEncodings->ContainsByPredicate([](const FString& AcceptEncoding)
+	{
+		return AcceptEncoding.Contains(TEXT("gzip"));
+	});
+
+	TArray<uint8> CompressedBody;
+	if (bAcceptsGzip && !Response->Headers.Contains(TEXT("Content-Encoding")) && Response->Body.Num() > 0
+		&& FGridlyApi::GzipCompress(Response->Body.GetData(), Response->Body.Num(), CompressedBody))
+	{
+		Response->Body = MoveTemp(CompressedBody);
+		Response->Headers.Add(TEXT("Content-Encoding"), { TEXT("gzip") });
+	}
+
+	NumRequests++;
+	BytesReceived += Request.Body.Num();
+	BytesSent += Response->Body.Num();
+	OnComplete(MoveTemp(Response));
+}
@@ -0,0 +1,85 @@
+﻿// Copyright (c) 2021 LocalizeDirect AB
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+
+class IHttpRouter;
+struct FHttpServerRequest;
+
+/** Shape of the synthetic view served by FGridlyMockServer */
+struct FGridlyMockViewSpec
+{
+	int32 NumRecords = 10000;
+	int32 NumNamespaces = 20;
+
+	/** Unreal cultures with a language column each, the first one is the source language */
+	TArray<FString> Cultures;
+
+	/** Records that only the export endpoint lists, so a sync has something to delete */
+	int32 NumGridlyOnlyRecords = 0;
+
+	/** Columns no import reads, such as notes or screenshot links, served after the language columns */
+	int32 NumOtherColumns = 2;
+};
+
+/**
+ * Local stand-in for the Gridly API. Serves a synthetic view from the records, export and delete endpoints, and counts
+ * the requests and bytes it handled. Requests only reach it while FGridlyApi points at GetBaseUrl().
+ */
+class FGridlyMockServer
+{
+public:
+	explicit FGridlyMockServer(const FGridlyMockViewSpec& InSpec);
+	~FGridlyMockServer();
+
+	/** Starts listening on Port, returns false if the port could not be bound */
+	bool Start(uint32 InPort);
+	void Stop();
+
+	FString GetBaseUrl() const;
+	const FGridlyMockViewSpec& GetSpec() const { return Spec; }
+
+	FString GetRecordId(int32 RecordIndex) const;
+	FString GetNamespace(int32 RecordIndex) const;
+	FString GetText(int32 RecordIndex, int32 CultureIndex) const;
+	const FString& GetColumnId(int32 CultureIndex) const { return ColumnIds[CultureIndex]; }
+
+	/** Records from Offset on, as the records endpoint returns them */
+	FString GetRecordsJson(int32 Offset, int32 Limit, const TArray<FString>& RequestedColumnIds = TArray<FString>()) const;
+
+	/** Record ID and path of every record in the view, plus the Gridly-only records, as the export endpoint returns them */
+	FString GetExportCsv() const;
+
+	int32 GetNumRequests() const { return NumRequests; }
+	int32 GetNumPostRecordsRequests() const { return NumPostRecordsRequests; }
+	/** Record IDs the delete endpoint was asked to remove */
+	int32 GetNumDeletedRecords() const { return NumDeletedRecords; }
+	int64 GetBytesReceived() const { return BytesReceived; }
+	int64 GetBytesSent() const { return BytesSent; }
+	void ResetCounters();
+
+private:
+	bool HandleGetRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandlePostRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleDeleteRecords(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+	bool HandleExport(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	void Complete(const FHttpServerRequest& Request, TUniquePtr<struct FHttpServerResponse> Response,
+		const FHttpResultCallback& OnComplete);
+
+	FGridlyMockViewSpec Spec;
+	TArray<FString> ColumnIds;
+
+	uint32 Port = 0;
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+
+	int32 NumRequests = 0;
+	int32 NumPostRecordsRequests = 0;
+	int32 NumDeletedRecords = 0;
+	int64 BytesReceived = 0;
+	int64 BytesSent = 0;
+};